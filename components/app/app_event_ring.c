@@ -0,0 +1,180 @@
+/**
+ * @file app_event_ring.c
+ * @author Marko Fuček
+ * @brief Implementacija lock-free ringa eventova aplikacijskog sloja.
+ * 
+ * Implementacija funkcija zadanih u headeru app_event_ring.h.
+ * 
+ * Pisač za poziciju p upisuje u slot (p % capacity): broj sekvence postavlja na 2p + 1, kopira event,
+ * postavlja broj sekvence na 2p + 2 i tek onda objavljuje write_pos = p + 1. Čitatelj za poziciju r
+ * očekuje broj sekvence 2r + 2 prije i poslije kopiranja - inače je slot u međuvremenu prepisan, pa se
+ * pozicija r preskače. Čitatelj nikad ne čeka pisača, pa ni visoki prioritet čitatelja na istoj jezgri
+ * ne može zaustaviti pisača.
+ * 
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+#include <string.h>
+#include "app/app_event_ring.h"
+#include "platform/platform_time.h"
+
+#define EVENT_RING_SIGNAL_DATA (1 << 0) //u ringu ima barem jedan event
+
+bool app_event_ring_init(AppEventRing_t* ring, void* storage, uint32_t* seq, size_t elem_size, uint32_t capacity)
+{
+    if(ring == NULL || storage == NULL || seq == NULL || elem_size == 0 || capacity == 0) {
+        return false;
+    }
+    if((capacity & (capacity - 1)) != 0) {
+        return false; //potencija broja 2 - indeks slota ostaje ispravan i kod prelijevanja pozicija
+    }
+    ring->storage = (uint8_t*)storage;
+    ring->seq = seq;
+    ring->elem_size = elem_size;
+    ring->capacity = capacity;
+    memset(seq, 0, capacity * sizeof(uint32_t));
+    __atomic_store_n(&ring->write_pos, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&ring->read_pos, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&ring->overwritten, 0, __ATOMIC_RELAXED);
+    ring->signal = platform_signal_create_static(&ring->signal_buffer);
+    return ring->signal != NULL;
+}
+
+void app_event_ring_deinit(AppEventRing_t* ring)
+{
+    if(ring == NULL || ring->signal == NULL) {
+        return;
+    }
+    platform_signal_delete(ring->signal);
+    ring->signal = NULL;
+    __atomic_store_n(&ring->read_pos, __atomic_load_n(&ring->write_pos, __ATOMIC_RELAXED), __ATOMIC_RELAXED);
+}
+
+bool app_event_ring_push(AppEventRing_t* ring, const void* elem)
+{
+    if(ring == NULL || ring->signal == NULL || elem == NULL) {
+        return false;
+    }
+
+    uint32_t pos = __atomic_load_n(&ring->write_pos, __ATOMIC_RELAXED); //samo pisač mijenja write_pos
+    uint32_t slot = pos & (ring->capacity - 1);
+    bool lossless = (pos - __atomic_load_n(&ring->read_pos, __ATOMIC_RELAXED)) < ring->capacity;
+
+    __atomic_store_n(&ring->seq[slot], 2 * pos + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE); //oznaka upisa vidljiva prije podataka
+    memcpy(ring->storage + slot * ring->elem_size, elem, ring->elem_size);
+    __atomic_store_n(&ring->seq[slot], 2 * pos + 2, __ATOMIC_RELEASE);
+    __atomic_store_n(&ring->write_pos, pos + 1, __ATOMIC_RELEASE);
+
+    if(!lossless) {
+        __atomic_fetch_add(&ring->overwritten, 1, __ATOMIC_RELAXED);
+    }
+    platform_signal_set(ring->signal, EVENT_RING_SIGNAL_DATA);
+    return lossless;
+}
+
+/**
+ * @brief Jedan neblokirajući pokušaj čitanja do max najstarijih eventova.
+ * 
+ * Eventovi se kopiraju redom dok slotovi nisu prepisani, a cijela serija se preuzima jednim CAS-om nad read_pos.
+ * 
+ * @param ring Pokazivač na kontrolnu strukturu ringa
+ * @param out Pokazivač na memoriju za barem max elemenata veličine elem_size
+ * @param max Najveći broj eventova za čitanje
+ * @param remaining Postavlja se na true ako je nakon čitanja u ringu ostalo još eventova
+ * @return Broj izvađenih eventova (0 ako je ring prazan)
+ */
+static size_t ring_try_pop(AppEventRing_t* ring, void* out, size_t max, bool* remaining)
+{
+    for(;;) {
+        uint32_t r = __atomic_load_n(&ring->read_pos, __ATOMIC_ACQUIRE);
+        uint32_t w = __atomic_load_n(&ring->write_pos, __ATOMIC_ACQUIRE);
+        if(r == w) {
+            *remaining = false;
+            return 0;
+        }
+        if(w - r > ring->capacity) {
+            //čitatelji su zaostali više od kapaciteta - preskačemo na najstariji event koji još postoji
+            __atomic_compare_exchange_n(&ring->read_pos, &r, w - ring->capacity, false,
+                __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+            continue;
+        }
+
+        size_t avail = w - r;
+        size_t want = (avail < max) ? avail : max;
+        size_t n = 0;
+        while(n < want) {
+            uint32_t pos = r + n;
+            uint32_t slot = pos & (ring->capacity - 1);
+            uint32_t expected = 2 * pos + 2;
+            uint8_t* dst = (uint8_t*)out + n * ring->elem_size;
+            if(__atomic_load_n(&ring->seq[slot], __ATOMIC_ACQUIRE) != expected) {
+                break;
+            }
+            memcpy(dst, ring->storage + slot * ring->elem_size, ring->elem_size);
+            __atomic_thread_fence(__ATOMIC_ACQUIRE); //kopija završena prije ponovne provjere
+            if(__atomic_load_n(&ring->seq[slot], __ATOMIC_RELAXED) != expected) {
+                break;
+            }
+            n++;
+        }
+
+        if(n == 0) {
+            //slot je prepisan (ili se upravo prepisuje) - event na poziciji r je izgubljen, ne čekamo pisača
+            __atomic_compare_exchange_n(&ring->read_pos, &r, r + 1, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+            continue;
+        }
+        //kopije su cijele - serija je naša samo ako nitko drugi nije u međuvremenu pomaknuo read_pos
+        if(__atomic_compare_exchange_n(&ring->read_pos, &r, r + n, false, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED)) {
+            *remaining = (r + n) != w;
+            return n;
+        }
+    }
+}
+
+size_t app_event_ring_pop_batch(AppEventRing_t* ring, void* out, size_t max, uint32_t timeout_ms)
+{
+    if(ring == NULL || ring->signal == NULL || out == NULL || max == 0) {
+        return 0;
+    }
+
+    uint32_t start = platform_getNumOfMs();
+    for(;;) {
+        //signal se briše prije provjere - push nakon provjere ga ponovno postavlja, pa buđenje ne može promaknuti
+        platform_signal_clear(ring->signal, EVENT_RING_SIGNAL_DATA);
+
+        bool remaining;
+        size_t n = ring_try_pop(ring, out, max, &remaining);
+        if(n > 0) {
+            if(remaining) {
+                //ostalim čitateljima javljamo da još ima eventova
+                platform_signal_set(ring->signal, EVENT_RING_SIGNAL_DATA);
+            }
+            return n;
+        }
+
+        uint32_t elapsed = platform_getNumOfMs() - start;
+        if(timeout_ms == 0 || elapsed >= timeout_ms) {
+            return 0;
+        }
+        uint32_t wait = (timeout_ms == PLATFORM_SIGNAL_WAIT_FOREVER) ? PLATFORM_SIGNAL_WAIT_FOREVER : (timeout_ms - elapsed);
+        platform_signal_wait(ring->signal, EVENT_RING_SIGNAL_DATA, false, false, wait);
+    }
+}
+
+bool app_event_ring_pop(AppEventRing_t* ring, void* out, uint32_t timeout_ms)
+{
+    return app_event_ring_pop_batch(ring, out, 1, timeout_ms) == 1;
+}
+
+uint32_t app_event_ring_overwritten(AppEventRing_t* ring)
+{
+    if(ring == NULL) {
+        return 0;
+    }
+    return __atomic_load_n(&ring->overwritten, __ATOMIC_RELAXED);
+}
\ No newline at end of file
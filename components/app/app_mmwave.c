@@ -20,6 +20,7 @@
 #include <stdbool.h>
 #include "app/app_mmwave.h"
 #include "app/app_mmwave_manager.h"
+#include "app/app_mmwave_request.h"
 
 static uint8_t data;
 
@@ -52,6 +53,46 @@ AppSensorStatus registrate_onEvent_function(MMwaveResponseCallback res_fun, MMwa
     return APP_SENSOR_OK;
 }
 
+AppSensorStatus mmwave_subscribe(const MmwaveSubscription* sub, int* out_id)
+{
+    return app_subscribe(sub, out_id);
+}
+
+AppSensorStatus mmwave_unsubscribe(int id)
+{
+    return app_unsubscribe(id);
+}
+
+void mmwave_register_ready_callback(MmwaveReadyCallback cb, void* user)
+{
+    app_register_ready_callback(cb, user);
+}
+
+bool mmwave_is_ready(void)
+{
+    return app_is_ready();
+}
+
+AppSensorStatus mmwave_wait_ready(uint32_t timeout_ms)
+{
+    return app_wait_ready(timeout_ms);
+}
+
+AppSensorStatus mmwave_schedule_inquiry(AppInquiryType type, uint32_t period_ms, int* out_id)
+{
+    return app_scheduler_add(type, period_ms, out_id);
+}
+
+AppSensorStatus mmwave_unschedule_inquiry(int id)
+{
+    return app_scheduler_remove(id);
+}
+
+AppSensorStatus mmwave_get_device_info(MmwaveDeviceInfo* out, uint32_t timeout_ms)
+{
+    return app_device_info_get(out, timeout_ms);
+}
+
 bool mmwave_poll_response(DecodedResponse* out, uint32_t timeout_ms)
 {
     return app_get_response(out, timeout_ms);
@@ -62,6 +103,45 @@ bool mmwave_poll_report(DecodedReport* out, uint32_t timeout_ms)
     return app_get_report(out, timeout_ms);
 }
 
+AppSensorStatus mmwave_get_state(MmwaveState* out)
+{
+    if(!out) {
+        return APP_SENSOR_BAD_ARGUMENT;
+    }
+    app_mmwave_state_read(out);
+    return APP_SENSOR_OK;
+}
+
+size_t mmwave_poll_responses(DecodedResponse* out, size_t max, uint32_t timeout_ms)
+{
+    return app_get_responses(out, max, timeout_ms);
+}
+
+size_t mmwave_poll_reports(DecodedReport* out, size_t max, uint32_t timeout_ms)
+{
+    return app_get_reports(out, max, timeout_ms);
+}
+
+size_t mmwave_poll_compact_reports(CompactReport* out, size_t max, uint32_t timeout_ms)
+{
+    return app_get_compact_reports(out, max, timeout_ms);
+}
+
+AppSensorStatus mmwave_apply_config(const MmwaveConfigProfile* profile, MmwaveConfigResult* result, uint32_t timeout_ms)
+{
+    return app_config_apply(profile, result, timeout_ms);
+}
+
+AppSensorStatus mmwave_sync_config(const MmwaveConfigProfile* profile, MmwaveConfigResult* result, uint32_t timeout_ms)
+{
+    return app_config_sync(profile, result, timeout_ms);
+}
+
+void mmwave_config_invalidate_cache(void)
+{
+    app_config_cache_invalidate();
+}
+
 AppSensorStatus app_inquiry_heartbeat(void)
 {
     data = HEARTBEAT_DATA;
@@ -406,6 +486,239 @@ AppSensorStatus app_inquiry_cm_time_for_no_person_get(void)
     return app_send_inquiry(&data, CM_UOF_TIME_FOR_NO_PERSON_I_LEN, CM_UOF_TIME_FOR_NO_PERSON_I_CTRL, CM_UOF_TIME_FOR_NO_PERSON_I_CMD);
 }
 
+AppSensorStatus mmwave_request_submit(const uint8_t* data, size_t data_len, uint8_t ctrl_w, uint8_t cmd_w,
+    uint32_t timeout_ms, AppRequestTicket* out_request)
+{
+    return app_request_submit(data, data_len, ctrl_w, cmd_w, timeout_ms, out_request);
+}
+
+AppSensorStatus mmwave_request_wait(const AppRequestTicket* request, DecodedResponse* out)
+{
+    return app_request_wait(request, out);
+}
+
+/**
+ * @brief Šalje upit s jednim bajtom podataka i čeka odgovor s jednim bajtom vrijednosti.
+ * 
+ * @param inquiry_data Podatak upita
+ * @param len Duljina podataka upita
+ * @param ctrl_w Control word
+ * @param cmd_w Command word
+ * @param value Pokazivač na mjesto za vrijednost iz odgovora (smije biti NULL)
+ * @param timeout_ms Najdulje čekanje na odgovor u ms
+ * @return Status operacije
+ */
+static AppSensorStatus inquiry_await_u8(uint8_t inquiry_data, size_t len, uint8_t ctrl_w, uint8_t cmd_w,
+    uint8_t* value, uint32_t timeout_ms)
+{
+    AppRequestTicket request;
+    DecodedResponse response;
+    AppSensorStatus status = app_request_submit(&inquiry_data, len, ctrl_w, cmd_w, timeout_ms, &request);
+    if(status != APP_SENSOR_OK) {
+        return status;
+    }
+    status = app_request_wait(&request, &response);
+    if(status != APP_SENSOR_OK) {
+        return status;
+    }
+    if(response.data_l < 1) {
+        return APP_SENSOR_ERROR;
+    }
+    if(value) {
+        *value = response.data[0];
+    }
+    return APP_SENSOR_OK;
+}
+
+AppSensorStatus app_inquiry_heartbeat_await(uint32_t timeout_ms)
+{
+    return inquiry_await_u8(HEARTBEAT_DATA, HEARTBEAT_LEN, HEARTBEAT_CTRL, HEARTBEAT_CMD, NULL, timeout_ms);
+}
+
+AppSensorStatus app_inquiry_scene_settings_get_await(SceneMode* scene, uint32_t timeout_ms)
+{
+    if(!scene) {
+        return APP_SENSOR_BAD_ARGUMENT;
+    }
+    uint8_t value;
+    AppSensorStatus status = inquiry_await_u8(SCENE_SETTINGS_I_DATA, SCENE_SETTINGS_I_LEN, SCENE_SETTINGS_I_CTRL, SCENE_SETTINGS_I_CMD, &value, timeout_ms);
+    if(status == APP_SENSOR_OK) {
+        *scene = (SceneMode)value;
+    }
+    return status;
+}
+
+AppSensorStatus app_inquiry_sensitivity_settings_get_await(SensitivityLevel* sensitivity, uint32_t timeout_ms)
+{
+    if(!sensitivity) {
+        return APP_SENSOR_BAD_ARGUMENT;
+    }
+    uint8_t value;
+    AppSensorStatus status = inquiry_await_u8(SENSITIVITY_SETTINGS_I_DATA, SENSITIVITY_SETTINGS_I_LEN, SENSITIVITY_SETTINGS_I_CTRL, SENSITIVITY_SETTINGS_I_CMD, &value, timeout_ms);
+    if(status == APP_SENSOR_OK) {
+        *sensitivity = (SensitivityLevel)value;
+    }
+    return status;
+}
+
+AppSensorStatus app_inquiry_presence_await(PresenceInfo* presence, uint32_t timeout_ms)
+{
+    if(app_get_mode() == SENSOR_MODE_UNDERLYING_OPEN) {
+        return APP_SENSOR_BAD_MODE;
+    }
+    if(!presence) {
+        return APP_SENSOR_BAD_ARGUMENT;
+    }
+    uint8_t value;
+    AppSensorStatus status = inquiry_await_u8(PRESENCE_INFO_I_DATA, PRESENCE_INFO_I_LEN, PRESENCE_INFO_I_CTRL, PRESENCE_INFO_I_CMD, &value, timeout_ms);
+    if(status == APP_SENSOR_OK) {
+        *presence = (PresenceInfo)value;
+    }
+    return status;
+}
+
+AppSensorStatus app_inquiry_motion_await(MotionInfo* motion, uint32_t timeout_ms)
+{
+    if(app_get_mode() == SENSOR_MODE_UNDERLYING_OPEN) {
+        return APP_SENSOR_BAD_MODE;
+    }
+    if(!motion) {
+        return APP_SENSOR_BAD_ARGUMENT;
+    }
+    uint8_t value;
+    AppSensorStatus status = inquiry_await_u8(MOTION_INFO_I_DATA, MOTION_INFO_I_LEN, MOTION_INFO_I_CTRL, MOTION_INFO_I_CMD, &value, timeout_ms);
+    if(status == APP_SENSOR_OK) {
+        *motion = (MotionInfo)value;
+    }
+    return status;
+}
+
+AppSensorStatus app_inquiry_bmp_await(uint8_t* bmp, uint32_t timeout_ms)
+{
+    if(app_get_mode() == SENSOR_MODE_UNDERLYING_OPEN) {
+        return APP_SENSOR_BAD_MODE;
+    }
+    if(!bmp) {
+        return APP_SENSOR_BAD_ARGUMENT;
+    }
+    return inquiry_await_u8(BMP_INFO_I_DATA, BMP_INFO_I_LEN, BMP_INFO_I_CTRL, BMP_INFO_I_CMD, bmp, timeout_ms);
+}
+
+AppSensorStatus app_inquiry_time_for_no_person_get_await(TimeForNoPerson* time, uint32_t timeout_ms)
+{
+    if(app_get_mode() == SENSOR_MODE_UNDERLYING_OPEN) {
+        return APP_SENSOR_BAD_MODE;
+    }
+    if(!time) {
+        return APP_SENSOR_BAD_ARGUMENT;
+    }
+    uint8_t value;
+    AppSensorStatus status = inquiry_await_u8(TIME_FOR_NO_PERSON_I_DATA, TIME_FOR_NO_PERSON_I_LEN, TIME_FOR_NO_PERSON_I_CTRL, TIME_FOR_NO_PERSON_I_CMD, &value, timeout_ms);
+    if(status == APP_SENSOR_OK) {
+        *time = (TimeForNoPerson)value;
+    }
+    return status;
+}
+
+AppSensorStatus app_inquiry_proximity_await(ProximityInfo* proximity, uint32_t timeout_ms)
+{
+    if(app_get_mode() == SENSOR_MODE_UNDERLYING_OPEN) {
+        return APP_SENSOR_BAD_MODE;
+    }
+    if(!proximity) {
+        return APP_SENSOR_BAD_ARGUMENT;
+    }
+    uint8_t value;
+    AppSensorStatus status = inquiry_await_u8(PROXIMITY_INFO_I_DATA, PROXIMITY_INFO_I_LEN, PROXIMITY_INFO_I_CTRL, PROXIMITY_INFO_I_CMD, &value, timeout_ms);
+    if(status == APP_SENSOR_OK) {
+        *proximity = (ProximityInfo)value;
+    }
+    return status;
+}
+
+AppSensorStatus app_inquiry_uof_output_switch_get_await(OutputSwitch* option, uint32_t timeout_ms)
+{
+    if(!option) {
+        return APP_SENSOR_BAD_ARGUMENT;
+    }
+    uint8_t value;
+    AppSensorStatus status = inquiry_await_u8(UOF_OUTPUT_SWITCH_I_DATA, UOF_OUTPUT_SWITCH_I_LEN, UOF_OUTPUT_SWITCH_I_CTRL, UOF_OUTPUT_SWITCH_I_CMD, &value, timeout_ms);
+    if(status == APP_SENSOR_OK) {
+        *option = (OutputSwitch)value;
+    }
+    return status;
+}
+
+AppSensorStatus app_inquiry_cm_get_await(CustomMode* mode_num, uint32_t timeout_ms)
+{
+    if(app_get_mode() == SENSOR_MODE_STANDARD) {
+        return APP_SENSOR_BAD_MODE;
+    }
+    if(!mode_num) {
+        return APP_SENSOR_BAD_ARGUMENT;
+    }
+    uint8_t value;
+    AppSensorStatus status = inquiry_await_u8(CM_Q_DATA, CM_Q_LEN, CM_Q_CTRL, CM_Q_CMD, &value, timeout_ms);
+    if(status == APP_SENSOR_OK) {
+        *mode_num = (CustomMode)value;
+    }
+    return status;
+}
+
+AppSensorStatus app_inquiry_cm_existence_judgement_thresh_get_await(uint8_t* existence_judgement_thresh, uint32_t timeout_ms)
+{
+    if(app_get_mode() == SENSOR_MODE_STANDARD) {
+        return APP_SENSOR_BAD_MODE;
+    }
+    if(!existence_judgement_thresh) {
+        return APP_SENSOR_BAD_ARGUMENT;
+    }
+    return inquiry_await_u8(CM_UOF_EXISTENCE_JUDGMENT_THRESH_I_DATA, CM_UOF_EXISTENCE_JUDGMENT_THRESH_I_LEN, CM_UOF_EXISTENCE_JUDGMENT_THRESH_I_CTRL, CM_UOF_EXISTENCE_JUDGMENT_THRESH_I_CMD, existence_judgement_thresh, timeout_ms);
+}
+
+AppSensorStatus app_inquiry_cm_motion_trigger_thresh_get_await(uint8_t* motion_trigger_thresh, uint32_t timeout_ms)
+{
+    if(app_get_mode() == SENSOR_MODE_STANDARD) {
+        return APP_SENSOR_BAD_MODE;
+    }
+    if(!motion_trigger_thresh) {
+        return APP_SENSOR_BAD_ARGUMENT;
+    }
+    return inquiry_await_u8(CM_UOF_MOTION_TRIGGER_THRESH_I_DATA, CM_UOF_MOTION_TRIGGER_THRESH_I_LEN, CM_UOF_MOTION_TRIGGER_THRESH_I_CTRL, CM_UOF_MOTION_TRIGGER_THRESH_I_CMD, motion_trigger_thresh, timeout_ms);
+}
+
+AppSensorStatus app_inquiry_cm_existence_perception_bound_get_await(ExistencePerceptionBound* bound, uint32_t timeout_ms)
+{
+    if(app_get_mode() == SENSOR_MODE_STANDARD) {
+        return APP_SENSOR_BAD_MODE;
+    }
+    if(!bound) {
+        return APP_SENSOR_BAD_ARGUMENT;
+    }
+    uint8_t value;
+    AppSensorStatus status = inquiry_await_u8(CM_UOF_EXISTENCE_PERCEPTION_BOUND_I_DATA, CM_UOF_EXISTENCE_PERCEPTION_BOUND_I_LEN, CM_UOF_EXISTENCE_PERCEPTION_BOUND_I_CTRL, CM_UOF_EXISTENCE_PERCEPTION_BOUND_I_CMD, &value, timeout_ms);
+    if(status == APP_SENSOR_OK) {
+        *bound = (ExistencePerceptionBound)value;
+    }
+    return status;
+}
+
+AppSensorStatus app_inquiry_cm_motion_trigger_bound_get_await(MotionTriggerBound* bound, uint32_t timeout_ms)
+{
+    if(app_get_mode() == SENSOR_MODE_STANDARD) {
+        return APP_SENSOR_BAD_MODE;
+    }
+    if(!bound) {
+        return APP_SENSOR_BAD_ARGUMENT;
+    }
+    uint8_t value;
+    AppSensorStatus status = inquiry_await_u8(CM_UOF_MOTION_TRIGGER_BOUND_I_DATA, CM_UOF_MOTION_TRIGGER_BOUND_I_LEN, CM_UOF_MOTION_TRIGGER_BOUND_I_CTRL, CM_UOF_MOTION_TRIGGER_BOUND_I_CMD, &value, timeout_ms);
+    if(status == APP_SENSOR_OK) {
+        *bound = (MotionTriggerBound)value;
+    }
+    return status;
+}
+
 void app_log_system_snapshot(void)
 {
     SystemSnapshot s;
@@ -419,6 +732,10 @@ void app_log_system_snapshot(void)
         printf("[%s] stack left: %lu B ", s.tasks[i].name, s.tasks[i].remaining_stack);
     }
     printf("\n");
+    printf("Parse: avg %lu ns, max %lu ns; Decode: avg %lu ns, max %lu ns\n", s.parse_avg_ns, s.parse_max_ns,
+        s.decode_avg_ns, s.decode_max_ns);
+    printf("UART RX: thresh %lu B, timeout %lu sym, wakeups/frame %lu.%02lu, overflows %lu\n", s.rx_thresh,
+        s.rx_timeout, s.rx_wakeups_per_frame_x100 / 100, s.rx_wakeups_per_frame_x100 % 100, s.rx_overflows);
 }
 
 AppSensorState app_get_mmwave_state()
@@ -0,0 +1,451 @@
+/**
+ * @file app_mmwave_config.c
+ * @author Marko Fuček
+ * @brief Implementacija konfiguracijskih transakcija i cachea postavki senzora.
+ * 
+ * Implementacija funkcija zadanih u headeru app_mmwave_config.h.
+ * 
+ * Profil se pretvara u niz koraka (jedan frame po postavci) koji se svi predaju tablici upita
+ * (app_mmwave_request) prije čekanja, pa HAL sve frame-ove ima u TX queue-u odjednom. Tablica upita
+ * uparuje echo odgovore s koracima i ponovno šalje postavke bez odgovora.
+ * 
+ * Svaka postavka ima svoj opis u tablici config_fields (indeks i odgovara bitu 1 << i): frame-ove za
+ * postavljanje i upit, dopušteni raspon i mode u kojem ju senzor prima. Cache drži jednu vrijednost po
+ * postavci s bitom valjanosti, a piše ga samo decoder task (atomarno), pa čitanje ne treba lock.
+ * 
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+#include "app/app_mmwave_config.h"
+#include "app/app_mmwave_manager.h"
+#include "app/app_mmwave_request.h"
+#include "platform/platform_time.h"
+
+#define CONFIG_FIELD_COUNT 8 //broj postavki u profilu (bitovi MmwaveConfigField)
+#define CONFIG_MAX_STEPS (CONFIG_FIELD_COUNT + 2) //postavke i najviše dva dodatna prebacivanja moda
+#define CONFIG_CACHE_VALID 0x100 //bit valjanosti vrijednosti u cacheu
+
+/**
+ * @enum ConfigModeRequirement
+ * @brief Mode senzora u kojem se postavka smije postaviti i pročitati.
+ * 
+ */
+typedef enum {
+    CONFIG_MODE_ANY, /**< U oba moda */
+    CONFIG_MODE_STANDARD, /**< Samo u Standard Mode */
+    CONFIG_MODE_UOF /**< Samo u Underlying Open Function Mode */
+} ConfigModeRequirement;
+
+/**
+ * @struct ConfigFieldInfo
+ * @brief Opis jedne postavke profila.
+ * 
+ */
+typedef struct {
+    ConfigModeRequirement mode; /**< Mode u kojem senzor prima postavku */
+    uint8_t min; /**< Najmanja dopuštena vrijednost */
+    uint8_t max; /**< Najveća dopuštena vrijednost */
+    uint8_t set_ctrl_w; /**< Control word postavljanja */
+    uint8_t set_cmd_w; /**< Command word postavljanja */
+    uint8_t set_len; /**< Duljina podataka postavljanja */
+    uint8_t query_ctrl_w; /**< Control word upita */
+    uint8_t query_cmd_w; /**< Command word upita */
+    uint8_t query_len; /**< Duljina podataka upita */
+    uint8_t query_data; /**< Podatak upita */
+    AppInquiryType set_type; /**< Tip echo odgovora na postavljanje */
+    AppInquiryType query_type; /**< Tip odgovora na upit */
+} ConfigFieldInfo;
+
+//indeks i opisuje postavku s bitom 1 << i (MmwaveConfigField)
+static const ConfigFieldInfo config_fields[CONFIG_FIELD_COUNT] = {
+    {CONFIG_MODE_ANY, SCENE_MODE_NO_SET, AREA_DETECTION,
+        SCENE_SETTINGS_CTRL, SCENE_SETTINGS_CMD, SCENE_SETTINGS_LEN,
+        SCENE_SETTINGS_I_CTRL, SCENE_SETTINGS_I_CMD, SCENE_SETTINGS_I_LEN, SCENE_SETTINGS_I_DATA,
+        SCENE_SETTINGS, SCENE_SETTINGS_I},
+    {CONFIG_MODE_ANY, SENSITIVITY_1, SENSITIVITY_3,
+        SENSITIVITY_SETTINGS_CTRL, SENSITIVITY_SETTINGS_CMD, SENSITIVITY_SETTINGS_LEN,
+        SENSITIVITY_SETTINGS_I_CTRL, SENSITIVITY_SETTINGS_I_CMD, SENSITIVITY_SETTINGS_I_LEN, SENSITIVITY_SETTINGS_I_DATA,
+        SENSITIVITY, SENSITIVITY_I},
+    {CONFIG_MODE_STANDARD, TIME_NONE, SIXTY_MIN,
+        TIME_FOR_NO_PERSON_SETTING_CTRL, TIME_FOR_NO_PERSON_SETTING_CMD, TIME_FOR_NO_PERSON_SETTING_LEN,
+        TIME_FOR_NO_PERSON_I_CTRL, TIME_FOR_NO_PERSON_I_CMD, TIME_FOR_NO_PERSON_I_LEN, TIME_FOR_NO_PERSON_I_DATA,
+        TIME_FOR_NO_PERSON, TIME_FOR_NO_PERSON_I},
+    {CONFIG_MODE_ANY, TURN_OFF, TURN_ON,
+        UOF_OUTPUT_SWITCH_CTRL, UOF_OUTPUT_SWITCH_CMD, UOF_OUTPUT_SWITCH_LEN,
+        UOF_OUTPUT_SWITCH_I_CTRL, UOF_OUTPUT_SWITCH_I_CMD, UOF_OUTPUT_SWITCH_I_LEN, UOF_OUTPUT_SWITCH_I_DATA,
+        OUTPUT_SWITCH, OUTPUT_SWITCH_I},
+    {CONFIG_MODE_UOF, 0, 250,
+        CM_EXISTENCE_JUDGMENT_THRESH_CTRL, CM_EXISTENCE_JUDGMENT_THRESH_CMD, CM_EXISTENCE_JUDGMENT_THRESH_LEN,
+        CM_UOF_EXISTENCE_JUDGMENT_THRESH_I_CTRL, CM_UOF_EXISTENCE_JUDGMENT_THRESH_I_CMD,
+        CM_UOF_EXISTENCE_JUDGMENT_THRESH_I_LEN, CM_UOF_EXISTENCE_JUDGMENT_THRESH_I_DATA,
+        EXISTENCE_JUDGMENT_THRESH, EXISTENCE_JUDGMENT_THRESH_I},
+    {CONFIG_MODE_UOF, 0, 250,
+        CM_MOTION_TRIGGER_THRESH_CTRL, CM_MOTION_TRIGGER_THRESH_CMD, CM_MOTION_TRIGGER_THRESH_LEN,
+        CM_UOF_MOTION_TRIGGER_THRESH_I_CTRL, CM_UOF_MOTION_TRIGGER_THRESH_I_CMD,
+        CM_UOF_MOTION_TRIGGER_THRESH_I_LEN, CM_UOF_MOTION_TRIGGER_THRESH_I_DATA,
+        MOTION_TRIGGER_THRESH, MOTION_TRIGGER_THRESH_I},
+    {CONFIG_MODE_UOF, EP_HALF_M, EP_FIVE_M,
+        CM_EXISTENCE_PERCEPTION_BOUND_CTRL, CM_EXISTENCE_PERCEPTION_BOUND_CMD, CM_EXISTENCE_PERCEPTION_BOUND_LEN,
+        CM_UOF_EXISTENCE_PERCEPTION_BOUND_I_CTRL, CM_UOF_EXISTENCE_PERCEPTION_BOUND_I_CMD,
+        CM_UOF_EXISTENCE_PERCEPTION_BOUND_I_LEN, CM_UOF_EXISTENCE_PERCEPTION_BOUND_I_DATA,
+        EXISTENCE_PERCEPTION_BOUND, EXISTENCE_PERCEPTION_BOUND_I},
+    {CONFIG_MODE_UOF, MT_HALF_M, MT_FIVE_M,
+        CM_MOTION_TRIGGER_BOUND_CTRL, CM_MOTION_TRIGGER_BOUND_CMD, CM_MOTION_TRIGGER_BOUND_LEN,
+        CM_UOF_MOTION_TRIGGER_BOUND_I_CTRL, CM_UOF_MOTION_TRIGGER_BOUND_I_CMD,
+        CM_UOF_MOTION_TRIGGER_BOUND_I_LEN, CM_UOF_MOTION_TRIGGER_BOUND_I_DATA,
+        MOTION_TRIGGER_BOUND, MOTION_TRIGGER_BOUND_I}
+};
+
+#define CONFIG_SWITCH_INDEX 3 //indeks UOF output switcha u config_fields
+
+static uint16_t config_cache[CONFIG_FIELD_COUNT]; //vrijednost | CONFIG_CACHE_VALID, 0 ako vrijednost nije poznata
+
+/**
+ * @struct ConfigStep
+ * @brief Jedna postavka profila spremna za slanje.
+ * 
+ */
+typedef struct {
+    uint8_t index; /**< Indeks postavke u config_fields */
+    uint8_t value; /**< Vrijednost koja se postavlja i očekuje u echo odgovoru */
+} ConfigStep;
+
+/**
+ * @brief Dohvaća vrijednost postavke iz profila.
+ * 
+ * @param profile Profil
+ * @param index Indeks postavke u config_fields
+ * @return Vrijednost postavke
+ */
+static uint8_t config_profile_value(const MmwaveConfigProfile* profile, size_t index)
+{
+    switch (index)
+    {
+    case 0:
+        return (uint8_t)profile->scene;
+    case 1:
+        return (uint8_t)profile->sensitivity;
+    case 2:
+        return (uint8_t)profile->time_for_no_person;
+    case 3:
+        return (uint8_t)profile->uof_output_switch;
+    case 4:
+        return profile->existence_judgment_thresh;
+    case 5:
+        return profile->motion_trigger_thresh;
+    case 6:
+        return (uint8_t)profile->existence_perception_bound;
+    default:
+        return (uint8_t)profile->motion_trigger_bound;
+    }
+}
+
+/**
+ * @brief Dohvaća vrijednost postavke iz cachea.
+ * 
+ * @param index Indeks postavke u config_fields
+ * @param value Pokazivač na mjesto za vrijednost
+ * @return true ako je vrijednost poznata
+ * @return false inače
+ */
+static bool config_cache_get(size_t index, uint8_t* value)
+{
+    uint16_t entry = __atomic_load_n(&config_cache[index], __ATOMIC_ACQUIRE);
+    *value = (uint8_t)entry;
+    return (entry & CONFIG_CACHE_VALID) != 0;
+}
+
+/**
+ * @brief Vraća masku postavki koje senzor prima u zadanom modu.
+ * 
+ * @param mode Mode senzora
+ * @return Maska postavki (MmwaveConfigField)
+ */
+static uint32_t config_fields_for_mode(ConfigModeRequirement mode)
+{
+    uint32_t mask = 0;
+    for(size_t i = 0; i < CONFIG_FIELD_COUNT; i++) {
+        if(config_fields[i].mode == mode) {
+            mask |= (1u << i);
+        }
+    }
+    return mask;
+}
+
+/**
+ * @brief Provjerava masku i vrijednosti profila.
+ * 
+ * @param profile Profil
+ * @return true ako je profil ispravan
+ * @return false inače
+ */
+static bool config_profile_valid(const MmwaveConfigProfile* profile)
+{
+    if(profile->fields == 0 || (profile->fields & ~MMWAVE_CONFIG_ALL)) {
+        return false;
+    }
+    for(size_t i = 0; i < CONFIG_FIELD_COUNT; i++) {
+        uint8_t value = config_profile_value(profile, i);
+        if((profile->fields & (1u << i)) && (value < config_fields[i].min || value > config_fields[i].max)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Dodaje korake za sve postavke profila zadane maskom.
+ * 
+ * @param profile Profil
+ * @param mask Maska postavki
+ * @param steps Polje koraka
+ * @param n Broj koraka u polju
+ * @return Novi broj koraka
+ */
+static size_t config_add_steps(const MmwaveConfigProfile* profile, uint32_t mask, ConfigStep* steps, size_t n)
+{
+    for(size_t i = 0; i < CONFIG_FIELD_COUNT; i++) {
+        if(profile->fields & mask & (1u << i)) {
+            steps[n++] = (ConfigStep){(uint8_t)i, config_profile_value(profile, i)};
+        }
+    }
+    return n;
+}
+
+/**
+ * @brief Pretvara profil u niz koraka redom kojim se šalju.
+ * 
+ * Prvo idu postavke koje ne ovise o modu, zatim postavke Standard Mode, pa postavke UOF Mode. Prije
+ * postavki za mode u kojem senzor nije dodaje se prebacivanje switcha, a na kraju se senzor vraća u
+ * mode zadan profilom (ili u početni).
+ * 
+ * @param profile Ispravan profil
+ * @param steps Polje za barem CONFIG_MAX_STEPS koraka
+ * @return Broj koraka
+ */
+static size_t config_build_steps(const MmwaveConfigProfile* profile, ConfigStep* steps)
+{
+    uint32_t fields = profile->fields;
+    uint32_t standard_fields = config_fields_for_mode(CONFIG_MODE_STANDARD);
+    uint32_t uof_fields = config_fields_for_mode(CONFIG_MODE_UOF);
+    uint8_t initial = (app_get_mode() == SENSOR_MODE_UNDERLYING_OPEN) ? TURN_ON : TURN_OFF;
+    uint8_t mode = initial;
+    bool switch_sent = false;
+
+    size_t n = config_add_steps(profile, config_fields_for_mode(CONFIG_MODE_ANY) & ~MMWAVE_CONFIG_UOF_OUTPUT_SWITCH,
+        steps, 0);
+    if(fields & standard_fields) {
+        if(mode != TURN_OFF) {
+            mode = TURN_OFF;
+            steps[n++] = (ConfigStep){CONFIG_SWITCH_INDEX, mode};
+            switch_sent = true;
+        }
+        n = config_add_steps(profile, standard_fields, steps, n);
+    }
+    if(fields & uof_fields) {
+        if(mode != TURN_ON) {
+            mode = TURN_ON;
+            steps[n++] = (ConfigStep){CONFIG_SWITCH_INDEX, mode};
+            switch_sent = true;
+        }
+        n = config_add_steps(profile, uof_fields, steps, n);
+    }
+    uint8_t final = (fields & MMWAVE_CONFIG_UOF_OUTPUT_SWITCH) ? (uint8_t)profile->uof_output_switch : initial;
+    if(mode != final || ((fields & MMWAVE_CONFIG_UOF_OUTPUT_SWITCH) && !switch_sent)) {
+        steps[n++] = (ConfigStep){CONFIG_SWITCH_INDEX, final};
+    }
+    return n;
+}
+
+/**
+ * @brief Šalje upite za zadane postavke u jednom naletu i čeka odgovore.
+ * 
+ * Odgovori pune cache (app_config_on_response), pa se ishod pojedinog upita ne provjerava - postavka
+ * bez odgovora ostaje nepoznata.
+ * 
+ * @param mask Maska postavki
+ * @param timeout_ms Najdulje čekanje na odgovore u ms
+ */
+static void config_query(uint32_t mask, uint32_t timeout_ms)
+{
+    AppRequestTicket requests[CONFIG_FIELD_COUNT];
+    bool submitted[CONFIG_FIELD_COUNT] = {false};
+    for(size_t i = 0; i < CONFIG_FIELD_COUNT; i++) {
+        if(mask & (1u << i)) {
+            const ConfigFieldInfo* info = &config_fields[i];
+            submitted[i] = app_request_submit(&info->query_data, info->query_len, info->query_ctrl_w,
+                info->query_cmd_w, timeout_ms, &requests[i]) == APP_SENSOR_OK;
+        }
+    }
+    for(size_t i = 0; i < CONFIG_FIELD_COUNT; i++) {
+        if(submitted[i]) {
+            app_request_wait(&requests[i], NULL);
+        }
+    }
+}
+
+/**
+ * @brief Čeka potvrdu jednog poslanog koraka i upisuje njegov ishod.
+ * 
+ * @param step Korak
+ * @param request Upit koraka
+ * @param submit_status Status predaje upita tablici upita
+ * @param confirmed Maska potvrđenih postavki
+ * @param failed Maska neuspjelih postavki
+ * @param status Ukupni status transakcije
+ */
+static void config_finish_step(const ConfigStep* step, const AppRequestTicket* request, AppSensorStatus submit_status,
+    uint32_t* confirmed, uint32_t* failed, AppSensorStatus* status)
+{
+    AppSensorStatus step_status = submit_status;
+    if(step_status == APP_SENSOR_OK) {
+        DecodedResponse echo;
+        step_status = app_request_wait(request, &echo);
+        if(step_status == APP_SENSOR_OK && (echo.data_l < 1 || echo.data[0] != step->value)) {
+            step_status = APP_SENSOR_ERROR;
+        }
+    }
+    if(step_status != APP_SENSOR_OK) {
+        *failed |= (1u << step->index);
+        //timeout se prijavljuje samo ako nije bilo druge greške
+        if(*status == APP_SENSOR_OK || *status == APP_SENSOR_TIMEOUT) {
+            *status = (step_status == APP_SENSOR_TIMEOUT) ? APP_SENSOR_TIMEOUT : APP_SENSOR_ERROR;
+        }
+        return;
+    }
+    *confirmed |= (1u << step->index);
+    if(step->index == CONFIG_SWITCH_INDEX) {
+        //mode sustava prati stvarno stanje senzora, pa se mijenja tek nakon potvrde
+        app_set_mode(step->value == TURN_ON ? SENSOR_MODE_UNDERLYING_OPEN : SENSOR_MODE_STANDARD);
+    }
+}
+
+AppSensorStatus app_config_apply(const MmwaveConfigProfile* profile, MmwaveConfigResult* result, uint32_t timeout_ms)
+{
+    if(result) {
+        result->confirmed = 0;
+        result->failed = 0;
+        result->skipped = 0;
+        result->elapsed_ms = 0;
+    }
+    if(!profile || !config_profile_valid(profile)) {
+        return APP_SENSOR_BAD_ARGUMENT;
+    }
+    ConfigStep steps[CONFIG_MAX_STEPS];
+    size_t n = config_build_steps(profile, steps);
+
+    //frame-ovi idu u TX queue jedan za drugim, a potvrde se čekaju tek nakon toga
+    uint32_t start = platform_getNumOfMs();
+    AppRequestTicket requests[CONFIG_MAX_STEPS];
+    AppSensorStatus step_status[CONFIG_MAX_STEPS];
+    uint32_t confirmed = 0;
+    uint32_t failed = 0;
+    AppSensorStatus status = APP_SENSOR_OK;
+    size_t waited = 0;
+    for(size_t i = 0; i <= n; i++) {
+        //povratak switcha nakon privremenog prebacivanja je isti frame kao prvo prebacivanje, a tablica upita
+        //bi ga pridružila upitu koji još čeka, pa se prije njegova slanja čekaju svi dotad poslani koraci
+        bool flush = (i == n);
+        for(size_t j = waited; j < i && !flush; j++) {
+            flush = (steps[j].index == steps[i].index && steps[j].value == steps[i].value);
+        }
+        while(flush && waited < i) {
+            config_finish_step(&steps[waited], &requests[waited], step_status[waited], &confirmed, &failed, &status);
+            waited++;
+        }
+        if(i < n) {
+            const ConfigFieldInfo* info = &config_fields[steps[i].index];
+            step_status[i] = app_request_submit(&steps[i].value, info->set_len, info->set_ctrl_w, info->set_cmd_w,
+                timeout_ms, &requests[i]);
+        }
+    }
+
+    if(result) {
+        //dodatna prebacivanja moda broje se samo ako nisu uspjela
+        result->confirmed = confirmed & ~failed & profile->fields;
+        result->failed = failed;
+        result->elapsed_ms = platform_getNumOfMs() - start;
+    }
+    return status;
+}
+
+AppSensorStatus app_config_sync(const MmwaveConfigProfile* profile, MmwaveConfigResult* result, uint32_t timeout_ms)
+{
+    if(result) {
+        result->confirmed = 0;
+        result->failed = 0;
+        result->skipped = 0;
+        result->elapsed_ms = 0;
+    }
+    if(!profile || !config_profile_valid(profile)) {
+        return APP_SENSOR_BAD_ARGUMENT;
+    }
+    uint32_t start = platform_getNumOfMs();
+    uint8_t value;
+
+    //1. postavke koje senzor daje u oba moda, uključujući switch prema kojem se usklađuje mode sustava
+    uint32_t unknown = 0;
+    for(size_t i = 0; i < CONFIG_FIELD_COUNT; i++) {
+        if(!config_cache_get(i, &value)) {
+            unknown |= (1u << i);
+        }
+    }
+    uint32_t any_fields = config_fields_for_mode(CONFIG_MODE_ANY);
+    config_query(unknown & (profile->fields | MMWAVE_CONFIG_UOF_OUTPUT_SWITCH) & any_fields, timeout_ms);
+    if(config_cache_get(CONFIG_SWITCH_INDEX, &value)) {
+        app_set_mode(value == TURN_ON ? SENSOR_MODE_UNDERLYING_OPEN : SENSOR_MODE_STANDARD);
+    }
+
+    //2. postavke koje senzor daje samo u trenutnom modu
+    ConfigModeRequirement mode = (app_get_mode() == SENSOR_MODE_UNDERLYING_OPEN) ? CONFIG_MODE_UOF :
+        CONFIG_MODE_STANDARD;
+    config_query(unknown & profile->fields & config_fields_for_mode(mode), timeout_ms);
+
+    //3. šalju se samo postavke koje se razlikuju ili su ostale nepoznate
+    uint32_t differ = 0;
+    for(size_t i = 0; i < CONFIG_FIELD_COUNT; i++) {
+        if((profile->fields & (1u << i)) &&
+            (!config_cache_get(i, &value) || value != config_profile_value(profile, i))) {
+            differ |= (1u << i);
+        }
+    }
+    AppSensorStatus status = APP_SENSOR_OK;
+    if(differ != 0) {
+        MmwaveConfigProfile changes = *profile;
+        changes.fields = differ;
+        status = app_config_apply(&changes, result, timeout_ms);
+    }
+    if(result) {
+        result->skipped = profile->fields & ~differ;
+        result->elapsed_ms = platform_getNumOfMs() - start;
+    }
+    return status;
+}
+
+void app_config_on_response(const DecodedResponse* response)
+{
+    if(response->type == MODULE_RESET) {
+        app_config_cache_invalidate();
+        return;
+    }
+    if(response->data_l < 1) {
+        return;
+    }
+    for(size_t i = 0; i < CONFIG_FIELD_COUNT; i++) {
+        if(response->type == config_fields[i].set_type || response->type == config_fields[i].query_type) {
+            __atomic_store_n(&config_cache[i], (uint16_t)(CONFIG_CACHE_VALID | response->data[0]), __ATOMIC_RELEASE);
+            return;
+        }
+    }
+}
+
+void app_config_cache_invalidate(void)
+{
+    for(size_t i = 0; i < CONFIG_FIELD_COUNT; i++) {
+        __atomic_store_n(&config_cache[i], 0, __ATOMIC_RELEASE);
+    }
+}
\ No newline at end of file
@@ -25,11 +25,61 @@
 static AppDecoderContext* context = NULL;
 static bool initialized = false;
 
+/**
+ * @struct ResponseEntry
+ * @brief Opis jednog odgovora senzora iz tablice APP_MMWAVE_RESPONSE_TABLE.
+ * 
+ */
+typedef struct {
+    uint8_t ctrl; /**< Control word */
+    uint8_t cmd; /**< Command word */
+    uint8_t len; /**< Očekivana duljina payloada */
+    AppInquiryType type; /**< Tip odgovora */
+} ResponseEntry;
+
+#define RESPONSE_INDEX_ENUM(ctrl, cmd, len, type) RESPONSE_IDX_##type,
+#define RESPONSE_ENTRY(ctrl, cmd, len, type) [RESPONSE_IDX_##type] = {(ctrl), (cmd), (len), type},
+#define RESPONSE_SLOT(ctrl, cmd, len, type) [(ctrl) & 0x0F][(cmd)] = RESPONSE_IDX_##type,
+
+//indeksi odgovora u tablici opisa (0 = nema odgovora)
+enum {
+    RESPONSE_IDX_NONE = 0,
+    APP_MMWAVE_RESPONSE_TABLE(RESPONSE_INDEX_ENUM)
+    RESPONSE_IDX_COUNT
+};
+_Static_assert(RESPONSE_IDX_COUNT <= UINT8_MAX, "tablica odgovora prevelika za uint8_t indeks");
+
+//opisi odgovora, generirani iz APP_MMWAVE_RESPONSE_TABLE
+static const ResponseEntry response_entries[RESPONSE_IDX_COUNT] = {
+    APP_MMWAVE_RESPONSE_TABLE(RESPONSE_ENTRY)
+};
+
+//indeks opisa po [ctrl & 0x0F][cmd] - sve ctrl riječi protokola razlikuju se u donja 4 bita
+static const uint8_t response_index[16][256] = {
+    APP_MMWAVE_RESPONSE_TABLE(RESPONSE_SLOT)
+};
+
+/**
+ * @brief Dohvaća opis odgovora za ctrl/cmd par u O(1).
+ * 
+ * @param ctrl_w Control word
+ * @param cmd_w Command word
+ * @return Pokazivač na opis odgovora ili NULL ako par nije odgovor
+ */
+static const ResponseEntry* response_lookup(uint8_t ctrl_w, uint8_t cmd_w)
+{
+    uint8_t idx = response_index[ctrl_w & 0x0F][cmd_w];
+    if(idx == RESPONSE_IDX_NONE || response_entries[idx].ctrl != ctrl_w) {
+        return NULL; //ctrl riječ s istim donjim bitovima koja nije u tablici
+    }
+    return &response_entries[idx];
+}
+
 /**
  * @brief Pomoćna funkcija koja resetira sadržaj dekodiranog reporta.
  * 
  * Postavlja sve zastavice reporta na false.
- * Koristi se prije obrade nove poruke kako bi se osiguralo čisto početno
+ * Koristi se prije pretvorbe kompaktnog reporta kako bi se osiguralo čisto početno
  * stanje report strukture.
  * 
  * @param dr Pokazivač na strukturu reporta
@@ -49,12 +99,41 @@ static void decoded_report_reset(DecodedReport* dr)
     dr->bmp_info = 0;
     dr->proximity_info = 0x00;
     dr->uof_rep.existence_energy = 0;
-    dr->uof_rep.motion_distance = 0.0;
     dr->uof_rep.motion_energy = 0;
+    dr->uof_rep.static_distance_cm = 0;
+    dr->uof_rep.motion_distance_cm = 0;
+    dr->uof_rep.motion_speed_cms = 0;
+#if !APP_UOF_NO_FLOAT
+    dr->uof_rep.motion_distance = 0.0;
     dr->uof_rep.motion_speed = 0.0;
     dr->uof_rep.static_distance = 0.0;
+#endif
+}
+
+//UOF kod -> vrijednost; kod n označava n * 50 cm, a kod izvan tablice 0
+static const int16_t uof_static_distance_cm[] = {0, 50, 100, 150, 200, 250, 300};
+static const int16_t uof_motion_distance_cm[] = {0, 50, 100, 150, 200, 250, 300, 350, 400};
+//UOF kod -> brzina; kodovi 0x01 - 0x14 su -450 do 500 cm/s u koracima od 50 cm/s (0x0A je 0)
+static const int16_t uof_motion_speed_cms[] = {
+    0, -450, -400, -350, -300, -250, -200, -150, -100, -50, 0,
+    50, 100, 150, 200, 250, 300, 350, 400, 450, 500
+};
+
+/**
+ * @brief Dohvaća vrijednost UOF koda iz tablice.
+ * 
+ * @param table Tablica vrijednosti indeksirana kodom
+ * @param table_len Broj elemenata tablice
+ * @param code Kod iz UOF reporta
+ * @return Vrijednost iz tablice ili 0 za kod izvan tablice
+ */
+static inline int16_t uof_lookup(const int16_t* table, size_t table_len, uint8_t code)
+{
+    return (code < table_len) ? table[code] : 0;
 }
 
+#define UOF_LOOKUP(table, code) uof_lookup((table), sizeof(table) / sizeof((table)[0]), (code))
+
 /**
  * @brief Pomoćna funkcija koja resetira sadržaj dekodiranog responsa.
  * 
@@ -67,6 +146,8 @@ static void decoded_report_reset(DecodedReport* dr)
 static void decoded_response_reset(DecodedResponse* dr)
 {
     dr->type = NO_TYPE;
+    dr->ctrl_w = 0;
+    dr->cmd_w = 0;
     dr->data_l = 0;
     memset(dr->data, 0, sizeof(dr->data));
 }
@@ -90,7 +171,7 @@ static void send_response_safe(DecodedResponse* response, const uint8_t* payload
         if(payload_len > 0) {
             memcpy(response->data, payload, payload_len);
         }
-        context->sendResponseCallback(*response);
+        context->sendResponseCallback(response);
     } else {
         printf("[decoder] ERROR: payload_len=%d exceeds MAX_RESPONSE_DATA_LEN=%d\n", payload_len, MAX_RESPONSE_DATA_LEN);
     }
@@ -114,7 +195,7 @@ void app_mmwave_decoder_deinit(void)
  * @note Ako dekoder nije inicijaliziran ili su ulazni parametri neispravni,
  * funkcija se prekida bez obrade.
  */
-void app_mmwave_decoder_process_frame(uint8_t* data, size_t data_len)
+void app_mmwave_decoder_process_frame(const uint8_t* data, size_t data_len)
 {
     if(!initialized) {
         printf("[DECODER] ERROR: not initialized\n");
@@ -144,74 +225,58 @@ void app_mmwave_decoder_process_frame(uint8_t* data, size_t data_len)
     /*printf("[decoder] frame len=%zu ctrl=0x%02X cmd=0x%02X\n",
        data_len, data[0], data[1]);*/
 
-    DecodedReport report;
-    DecodedResponse response;
-    decoded_report_reset(&report);
-    decoded_response_reset(&response);
     uint8_t ctrl_w = data[0];
     uint8_t cmd_w = data[1];
     int payload_len = data_len - 2;
 
-    //Reports:
+    //Responses - jedan dohvat iz tablice umjesto niza usporedbi
+    const ResponseEntry* entry = response_lookup(ctrl_w, cmd_w);
+    if(entry != NULL && (payload_len == entry->len || entry->len == RESPONSE_LEN_VARIABLE)) {
+        DecodedResponse response;
+        decoded_response_reset(&response);
+        response.type = entry->type;
+        response.ctrl_w = ctrl_w;
+        response.cmd_w = cmd_w;
+        send_response_safe(&response, &data[2], payload_len);
+        return;
+    }
+
+    CompactReport report = {0};
+
+    //Reports - samo jedna vrsta po reportu, pa se šalje kompaktni oblik (vrsta + sirove vrijednosti):
     if(ctrl_w == INIT_COMPL_INFO_CTRL && cmd_w == INIT_COMPL_INFO_CMD) {
-        report.has_init_completed_info = true;
-        report.init_completed_info = true;
-        context->sendReportCallback(report);
+        report.kind = REPORT_KIND_INIT_COMPLETED;
+        report.value = 1;
+        context->sendReportCallback(&report);
     } else if(ctrl_w == 0x80) {
         switch (cmd_w)
         {
         case PRESENCE_INFO_CMD:
-            if(payload_len == PRESENCE_INFO_LEN) {
-                if(data[2] == 0x00) {
-                    report.has_presence_info = true;
-                    report.presence_info = UNOCCUPIED;
-                    context->sendReportCallback(report);
-                } else if(data[2] == 0x01) {
-                    report.has_presence_info = true;
-                    report.presence_info = OCCUPIED;
-                    context->sendReportCallback(report);
-                }
+            if(payload_len == PRESENCE_INFO_LEN && data[2] <= OCCUPIED) {
+                report.kind = REPORT_KIND_PRESENCE;
+                report.value = data[2];
+                context->sendReportCallback(&report);
             }
             break;
         case MOTION_INFO_CMD:
-            if(payload_len == MOTION_INFO_LEN) {
-                if(data[2] == 0x00) {
-                    report.has_motion_info = true;
-                    report.motion_info = MOTION_NONE;
-                    context->sendReportCallback(report);
-                } else if(data[2] == 0x01) {
-                    report.has_motion_info = true;
-                    report.motion_info = MOTIONLESS;
-                    context->sendReportCallback(report);
-                } else if(data[2] == 0x02) {
-                    report.has_motion_info = true;
-                    report.motion_info = ACTIVE;
-                    context->sendReportCallback(report);
-                }
+            if(payload_len == MOTION_INFO_LEN && data[2] <= ACTIVE) {
+                report.kind = REPORT_KIND_MOTION;
+                report.value = data[2];
+                context->sendReportCallback(&report);
             }
             break;
         case BMP_INFO_CMD:
             if(payload_len == BMP_INFO_LEN) {
-                report.has_bmp_info = true;
-                report.bmp_info = data[2];
-                context->sendReportCallback(report);
+                report.kind = REPORT_KIND_BMP;
+                report.value = data[2];
+                context->sendReportCallback(&report);
             }
             break;
         case PROXIMITY_INFO_CMD:
-            if(payload_len == PROXIMITY_INFO_LEN) {
-                if(data[2] == 0x00) {
-                    report.has_proximity_info = true;
-                    report.proximity_info = NO_STATE;
-                    context->sendReportCallback(report);
-                } else if(data[2] == 0x01) {
-                    report.has_proximity_info = true;
-                    report.proximity_info = NEAR;
-                    context->sendReportCallback(report);
-                } else if(data[2] == 0x02) {
-                    report.has_proximity_info = true;
-                    report.proximity_info = FAR;
-                    context->sendReportCallback(report);
-                }
+            if(payload_len == PROXIMITY_INFO_LEN && data[2] <= FAR) {
+                report.kind = REPORT_KIND_PROXIMITY;
+                report.value = data[2];
+                context->sendReportCallback(&report);
             }
             break;
         default:
@@ -219,290 +284,58 @@ void app_mmwave_decoder_process_frame(uint8_t* data, size_t data_len)
         }
     } else if(ctrl_w == UOF_REPORT_CTRL) {
         if(payload_len == UOF_REPORT_LEN) {
-            report.has_uof_report = true;
-            report.uof_rep.existence_energy = data[2];
-            report.uof_rep.motion_energy = data[4];
-            switch (data[3])
-            {
-            case 0x01:
-                report.uof_rep.static_distance = 0.5;
-                break;
-            case 0x02:
-                report.uof_rep.static_distance = 1;
-                break;
-            case 0x03:
-                report.uof_rep.static_distance = 1.5;
-                break;
-            case 0x04:
-                report.uof_rep.static_distance = 2;
-                break;
-            case 0x05:
-                report.uof_rep.static_distance = 2.5;
-                break;
-            case 0x06:
-                report.uof_rep.static_distance = 3;
-                break;
-            default:
-                break;
-            }
-            switch (data[5])
-            {
-            case 0x01:
-                report.uof_rep.motion_distance = 0.5;
-                break;
-            case 0x02:
-                report.uof_rep.motion_distance = 1;
-                break;
-            case 0x03:
-                report.uof_rep.motion_distance = 1.5;
-                break;
-            case 0x04:
-                report.uof_rep.motion_distance = 2;
-                break;
-            case 0x05:
-                report.uof_rep.motion_distance = 2.5;
-                break;
-            case 0x06:
-                report.uof_rep.motion_distance = 3;
-                break;
-            case 0x07:
-                report.uof_rep.motion_distance = 3.5;
-                break;
-            case 0x08:
-                report.uof_rep.motion_distance = 4;
-                break;
-            default:
-                break;
-            }
-            switch (data[6])
-            {
-            case 0x01:
-                report.uof_rep.motion_speed = -4.5;
-                break;
-            case 0x02:
-                report.uof_rep.motion_speed = -4;
-                break;
-            case 0x03:
-                report.uof_rep.motion_speed = -3.5;
-                break;
-            case 0x04:
-                report.uof_rep.motion_speed = -3;
-                break;
-            case 0x05:
-                report.uof_rep.motion_speed = -2.5;
-                break;
-            case 0x06:
-                report.uof_rep.motion_speed = -2;
-                break;
-            case 0x07:
-                report.uof_rep.motion_speed = -1.5;
-                break;
-            case 0x08:
-                report.uof_rep.motion_speed = -1;
-                break;
-            case 0x09:
-                report.uof_rep.motion_speed = -0.5;
-                break;
-            case 0x0a:
-                report.uof_rep.motion_speed = 0;
-                break;
-            case 0x0b:
-                report.uof_rep.motion_speed = 0.5;
-                break;
-            case 0x0c:
-                report.uof_rep.motion_speed = 1;
-                break;
-            case 0x0d:
-                report.uof_rep.motion_speed = 1.5;
-                break;
-            case 0x0e:
-                report.uof_rep.motion_speed = 2;
-                break;
-            case 0x0f:
-                report.uof_rep.motion_speed = 2.5;
-                break;
-            case 0x10:
-                report.uof_rep.motion_speed = 3;
-                break;
-            case 0x11:
-                report.uof_rep.motion_speed = 3.5;
-                break;
-            case 0x12:
-                report.uof_rep.motion_speed = 4;
-                break;
-            case 0x13:
-                report.uof_rep.motion_speed = 4.5;
-                break;
-            case 0x14:
-                report.uof_rep.motion_speed = 5;
-                break;
-            default:
-                break;
-            }
-            context->sendReportCallback(report);
+            //UOF kodovi se prenose sirovi - u metre i m/s pretvaraju se tek kod čitanja (app_mmwave_decoder_expand_report)
+            report.kind = REPORT_KIND_UOF;
+            report.uof.existence_energy = data[2];
+            report.uof.static_distance = data[3];
+            report.uof.motion_energy = data[4];
+            report.uof.motion_distance = data[5];
+            report.uof.motion_speed = data[6];
+            context->sendReportCallback(&report);
         }
     }
 
-    //Responses
-    //Implementirat ću samo najbitnije responsove (za funkcije koje se navjviše koriste) - ostali ili kasnije ili nisu potrebni
-    if(ctrl_w == HEARTBEAT_CTRL && cmd_w == HEARTBEAT_CMD && payload_len == HEARTBEAT_LEN) {
-        response.type = HEARTBEAT;
-        send_response_safe(&response, &data[2], payload_len);
-    }
-    if(ctrl_w == MODULE_RESET_CTRL && cmd_w == MODULE_RESET_CMD && payload_len == MODULE_RESET_LEN) {
-        response.type = MODULE_RESET;
-        send_response_safe(&response, &data[2], payload_len);
-    }
-    if(ctrl_w == PR_MODEL_CTRL && cmd_w == PR_MODEL_CMD && payload_len == PR_MODEL_LEN) {
-        response.type = PRODUCT_MODEL;
-        send_response_safe(&response, &data[2], payload_len);
-    }
-    if(ctrl_w == PR_ID_CTRL && cmd_w == PR_ID_CMD && payload_len == PR_ID_LEN) {
-        response.type = PRODUCT_ID;
-        send_response_safe(&response, &data[2], payload_len);
-    }
-    if(ctrl_w == HW_MODEL_CTRL && cmd_w == HW_MODEL_CMD && payload_len == HW_MODEL_LEN) {
-        response.type = HARDWARE_MODEL;
-        send_response_safe(&response, &data[2], payload_len);
-    }
-    if(ctrl_w == FW_VERSION_CTRL && cmd_w == FW_VERSION_CMD && payload_len == FW_VERSION_LEN) {
-        response.type = FIRMWARE_VERSION;
-        send_response_safe(&response, &data[2], payload_len);
-    }
-    if(ctrl_w == SCENE_SETTINGS_CTRL && cmd_w == SCENE_SETTINGS_CMD && payload_len == SCENE_SETTINGS_LEN) {
-        response.type = SCENE_SETTINGS;
-        send_response_safe(&response, &data[2], payload_len);
-    }
-    if(ctrl_w == SCENE_SETTINGS_I_CTRL && cmd_w == SCENE_SETTINGS_I_CMD && payload_len == SCENE_SETTINGS_I_LEN) {
-        response.type = SCENE_SETTINGS_I;
-        send_response_safe(&response, &data[2], payload_len);
-    }
-    if(ctrl_w == SENSITIVITY_SETTINGS_I_CTRL && cmd_w == SENSITIVITY_SETTINGS_I_CMD && payload_len == SENSITIVITY_SETTINGS_I_LEN) {
-        response.type = SENSITIVITY_I;
-        send_response_safe(&response, &data[2], payload_len);
-    }
-    if(ctrl_w == SENSITIVITY_SETTINGS_CTRL && cmd_w == SENSITIVITY_SETTINGS_CMD && payload_len == SENSITIVITY_SETTINGS_LEN) {
-        response.type = SENSITIVITY;
-        send_response_safe(&response, &data[2], payload_len);
-    }
-    if(ctrl_w == PRESENCE_INFO_I_CTRL && cmd_w == PRESENCE_INFO_I_CMD && payload_len == PRESENCE_INFO_I_LEN) {
-        response.type = PRESENCE;
-        send_response_safe(&response, &data[2], payload_len);
-    }
-    if(ctrl_w == MOTION_INFO_I_CTRL && cmd_w == MOTION_INFO_I_CMD && payload_len == MOTION_INFO_I_LEN) {
-        response.type = MOTION;
-        send_response_safe(&response, &data[2], payload_len);
-    }
-    if(ctrl_w == BMP_INFO_I_CTRL && cmd_w == BMP_INFO_I_CMD && payload_len == BMP_INFO_I_LEN) {
-        response.type = BMP;
-        send_response_safe(&response, &data[2], payload_len);
-    }
-    if(ctrl_w == TIME_FOR_NO_PERSON_I_CTRL && cmd_w == TIME_FOR_NO_PERSON_I_CMD && payload_len == TIME_FOR_NO_PERSON_I_LEN) {
-        response.type = TIME_FOR_NO_PERSON_I;
-        send_response_safe(&response, &data[2], payload_len);
-    }
-    if(ctrl_w == TIME_FOR_NO_PERSON_SETTING_CTRL && cmd_w == TIME_FOR_NO_PERSON_SETTING_CMD && payload_len == TIME_FOR_NO_PERSON_SETTING_LEN) {
-        response.type = TIME_FOR_NO_PERSON;
-        send_response_safe(&response, &data[2], payload_len);
-    }
-    if(ctrl_w == PROXIMITY_INFO_I_CTRL && cmd_w == PROXIMITY_INFO_I_CMD && payload_len == PROXIMITY_INFO_I_LEN) {
-        response.type = PROXIMITY;
-        send_response_safe(&response, &data[2], payload_len);
-    }
-    if(ctrl_w == UOF_OUTPUT_SWITCH_CTRL && cmd_w == UOF_OUTPUT_SWITCH_CMD && payload_len == UOF_OUTPUT_SWITCH_LEN) {
-        response.type = OUTPUT_SWITCH;
-        send_response_safe(&response, &data[2], payload_len);
-    }
-    if(ctrl_w == UOF_OUTPUT_SWITCH_I_CTRL && cmd_w == UOF_OUTPUT_SWITCH_I_CMD && payload_len == UOF_OUTPUT_SWITCH_I_LEN) {
-        response.type = OUTPUT_SWITCH_I;
-        send_response_safe(&response, &data[2], payload_len);
-    }
-    if(ctrl_w == UOF_EXISTENCE_ENERGY_I_CTRL && cmd_w == UOF_EXISTENCE_ENERGY_I_CMD && payload_len == UOF_EXISTENCE_ENERGY_I_LEN) {
-        response.type = EXISTENCE_ENERGY;
-        send_response_safe(&response, &data[2], payload_len);
-    }
-    if(ctrl_w == UOF_MOTION_ENERGY_I_CTRL && cmd_w == UOF_MOTION_ENERGY_I_CMD && payload_len == UOF_MOTION_ENERGY_I_LEN) {
-        response.type = MOTION_ENERGY;
-        send_response_safe(&response, &data[2], payload_len);
-    }
-    if(ctrl_w == UOF_STATIC_DISTANCE_I_CTRL && cmd_w == UOF_STATIC_DISTANCE_I_CMD && payload_len == UOF_STATIC_DISTANCE_I_LEN) {
-        response.type = STATIC_DISTANCE;
-        send_response_safe(&response, &data[2], payload_len);
-    }
-    if(ctrl_w == UOF_MOTION_DISTANCE_I_CTRL && cmd_w == UOF_MOTION_DISTANCE_I_CMD && payload_len == UOF_MOTION_DISTANCE_I_LEN) {
-        response.type = MOTION_DISTANCE;
-        send_response_safe(&response, &data[2], payload_len);
-    }
-    if(ctrl_w == UOF_MOTION_SPEED_I_CTRL && cmd_w == UOF_MOTION_SPEED_I_CMD && payload_len == UOF_MOTION_SPEED_I_LEN) {
-        response.type = MOTION_SPEED;
-        send_response_safe(&response, &data[2], payload_len);
-    }
-    if(ctrl_w == CM_SETTING_CTRL && cmd_w == CM_SETTING_CMD && payload_len == CM_SETTING_LEN) {
-        response.type = CUSTOM_MODE;
-        send_response_safe(&response, &data[2], payload_len);
-    }
-    if(ctrl_w == CM_SETTING_END_CTRL && cmd_w == CM_SETTING_END_CMD && payload_len == CM_SETTING_END_LEN) {
-        response.type = CUSTOM_MODE_END;
-        send_response_safe(&response, &data[2], payload_len);
-    }
-    if(ctrl_w == CM_Q_CTRL && cmd_w == CM_Q_CMD && payload_len == CM_Q_LEN) {
-        response.type = CUSTOM_MODE_I;
-        send_response_safe(&response, &data[2], payload_len);
-    }
-    if(ctrl_w == CM_UOF_EXISTENCE_JUDGMENT_THRESH_I_CTRL && cmd_w == CM_UOF_EXISTENCE_JUDGMENT_THRESH_I_CMD && payload_len == CM_UOF_EXISTENCE_JUDGMENT_THRESH_I_LEN) {
-        response.type = EXISTENCE_JUDGMENT_THRESH_I;
-        send_response_safe(&response, &data[2], payload_len);
-    }
-    if(ctrl_w == CM_UOF_MOTION_TRIGGER_THRESH_I_CTRL && cmd_w == CM_UOF_MOTION_TRIGGER_THRESH_I_CMD && payload_len == CM_UOF_MOTION_TRIGGER_THRESH_I_LEN) {
-        response.type = MOTION_TRIGGER_THRESH_I;
-        send_response_safe(&response, &data[2], payload_len);
-    }
-    if(ctrl_w == CM_UOF_EXISTENCE_PERCEPTION_BOUND_I_CTRL && cmd_w == CM_UOF_EXISTENCE_PERCEPTION_BOUND_I_CMD && payload_len == CM_UOF_EXISTENCE_PERCEPTION_BOUND_I_LEN) {
-        response.type = EXISTENCE_PERCEPTION_BOUND_I;
-        send_response_safe(&response, &data[2], payload_len);
-    }
-    if(ctrl_w == CM_UOF_MOTION_TRIGGER_BOUND_I_CTRL && cmd_w == CM_UOF_MOTION_TRIGGER_BOUND_I_CMD && payload_len == CM_UOF_MOTION_TRIGGER_BOUND_I_LEN) {
-        response.type = MOTION_TRIGGER_BOUND_I;
-        send_response_safe(&response, &data[2], payload_len);
-    }
-    if(ctrl_w == CM_UOF_MOTION_TRIGGER_TIME_I_CTRL && cmd_w == CM_UOF_MOTION_TRIGGER_TIME_I_CMD && payload_len == CM_UOF_MOTION_TRIGGER_TIME_I_LEN) {
-        response.type = MOTION_TRIGGER_TIME_I;
-        send_response_safe(&response, &data[2], payload_len);
-    }
-    if(ctrl_w == CM_UOF_MOTION_TO_STILL_TIME_I_CTRL && cmd_w == CM_UOF_MOTION_TO_STILL_TIME_I_CMD && payload_len == CM_UOF_MOTION_TO_STILL_TIME_I_LEN) {
-        response.type = MOTION_TO_STILL_TIME_I;
-        send_response_safe(&response, &data[2], payload_len);
-    }
-    if(ctrl_w == CM_UOF_TIME_FOR_NO_PERSON_I_CTRL && cmd_w == CM_UOF_TIME_FOR_NO_PERSON_I_CMD && payload_len == CM_UOF_TIME_FOR_NO_PERSON_I_LEN) {
-        response.type = CM_TIME_FOR_NO_PERSON_I;
-        send_response_safe(&response, &data[2], payload_len);
-    }
-    if(ctrl_w == CM_EXISTENCE_JUDGMENT_THRESH_CTRL && cmd_w == CM_EXISTENCE_JUDGMENT_THRESH_CMD && payload_len == CM_EXISTENCE_JUDGMENT_THRESH_LEN) {
-        response.type = EXISTENCE_JUDGMENT_THRESH;
-        send_response_safe(&response, &data[2], payload_len);
-    }
-    if(ctrl_w == CM_MOTION_TRIGGER_THRESH_CTRL && cmd_w == CM_MOTION_TRIGGER_THRESH_CMD && payload_len == CM_MOTION_TRIGGER_THRESH_LEN) {
-        response.type = MOTION_TRIGGER_THRESH;
-        send_response_safe(&response, &data[2], payload_len);
-    }
-    if(ctrl_w == CM_EXISTENCE_PERCEPTION_BOUND_CTRL && cmd_w == CM_EXISTENCE_PERCEPTION_BOUND_CMD && payload_len == CM_EXISTENCE_PERCEPTION_BOUND_LEN) {
-        response.type = EXISTENCE_PERCEPTION_BOUND;
-        send_response_safe(&response, &data[2], payload_len);
-    }
-    if(ctrl_w == CM_MOTION_TRIGGER_BOUND_CTRL && cmd_w == CM_MOTION_TRIGGER_BOUND_CMD && payload_len == CM_MOTION_TRIGGER_BOUND_LEN) {
-        response.type = MOTION_TRIGGER_BOUND;
-        send_response_safe(&response, &data[2], payload_len);
-    }
-    if(ctrl_w == CM_MOTION_TRIGGER_TIME_CTRL && cmd_w == CM_MOTION_TRIGGER_TIME_CMD && payload_len == CM_MOTION_TRIGGER_TIME_LEN) {
-        response.type = MOTION_TRIGGER_TIME;
-        send_response_safe(&response, &data[2], payload_len);
-    }
-    if(ctrl_w == CM_MOTION_TO_STILL_TIME_CTRL && cmd_w == CM_MOTION_TO_STILL_TIME_CMD && payload_len == CM_MOTION_TO_STILL_TIME_LEN) {
-        response.type = MOTION_TO_STILL_TIME;
-        send_response_safe(&response, &data[2], payload_len);
-    }
-    if(ctrl_w == CM_TIME_FOR_NO_PERSON_CTRL && cmd_w == CM_TIME_FOR_NO_PERSON_CMD && payload_len == CM_TIME_FOR_NO_PERSON_LEN) {
-        response.type = CM_TIME_FOR_NO_PERSON;
-        send_response_safe(&response, &data[2], payload_len);
+}
+
+void app_mmwave_decoder_expand_report(const CompactReport* in, DecodedReport* out)
+{
+    decoded_report_reset(out);
+    switch (in->kind)
+    {
+    case REPORT_KIND_INIT_COMPLETED:
+        out->has_init_completed_info = true;
+        out->init_completed_info = in->value != 0;
+        break;
+    case REPORT_KIND_PRESENCE:
+        out->has_presence_info = true;
+        out->presence_info = (PresenceInfo)in->value;
+        break;
+    case REPORT_KIND_MOTION:
+        out->has_motion_info = true;
+        out->motion_info = (MotionInfo)in->value;
+        break;
+    case REPORT_KIND_BMP:
+        out->has_bmp_info = true;
+        out->bmp_info = in->value;
+        break;
+    case REPORT_KIND_PROXIMITY:
+        out->has_proximity_info = true;
+        out->proximity_info = (ProximityInfo)in->value;
+        break;
+    case REPORT_KIND_UOF:
+        out->has_uof_report = true;
+        out->uof_rep.existence_energy = in->uof.existence_energy;
+        out->uof_rep.motion_energy = in->uof.motion_energy;
+        out->uof_rep.static_distance_cm = UOF_LOOKUP(uof_static_distance_cm, in->uof.static_distance);
+        out->uof_rep.motion_distance_cm = UOF_LOOKUP(uof_motion_distance_cm, in->uof.motion_distance);
+        out->uof_rep.motion_speed_cms = UOF_LOOKUP(uof_motion_speed_cms, in->uof.motion_speed);
+#if !APP_UOF_NO_FLOAT
+        out->uof_rep.static_distance = out->uof_rep.static_distance_cm / 100.0f;
+        out->uof_rep.motion_distance = out->uof_rep.motion_distance_cm / 100.0f;
+        out->uof_rep.motion_speed = out->uof_rep.motion_speed_cms / 100.0f;
+#endif
+        break;
+    default:
+        break;
     }
 }
\ No newline at end of file
@@ -0,0 +1,157 @@
+/**
+ * @file app_mmwave_device_info.c
+ * @author Marko Fuček
+ * @brief Implementacija cachea podataka o uređaju.
+ * 
+ * Implementacija funkcija zadanih u headeru app_mmwave_device_info.h.
+ * 
+ * Cache piše samo decoder task, a čitaju ga aplikacija i network task, pa ga štiti mutex (stringovi se ne
+ * mogu kopirati atomarno). Svaki podatak ima svoj bit valjanosti u maski.
+ * 
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+#include <stddef.h>
+#include <string.h>
+#include "app/app_mmwave_device_info.h"
+#include "app/app_mmwave_manager.h"
+#include "app/app_mmwave_request.h"
+#include "app/app_mmwave_constants.h"
+#include "platform/platform_mutex.h"
+
+#define DEVICE_INFO_FIELD_COUNT 4 //broj podataka o uređaju
+#define DEVICE_INFO_ALL ((1u << DEVICE_INFO_FIELD_COUNT) - 1) //maska svih podataka
+
+/**
+ * @struct DeviceInfoField
+ * @brief Opis jednog podatka o uređaju.
+ * 
+ */
+typedef struct {
+    AppInquiryType type; /**< Tip odgovora */
+    uint8_t ctrl_w; /**< Control word upita */
+    uint8_t cmd_w; /**< Command word upita */
+    uint8_t query_len; /**< Duljina podataka upita */
+    uint8_t query_data; /**< Podatak upita */
+    size_t offset; /**< Pomak stringa u MmwaveDeviceInfo */
+} DeviceInfoField;
+
+static const DeviceInfoField device_info_fields[DEVICE_INFO_FIELD_COUNT] = {
+    {PRODUCT_MODEL, PR_MODEL_CTRL, PR_MODEL_CMD, PR_MODEL_LEN, PR_MODEL_DATA, offsetof(MmwaveDeviceInfo, product_model)},
+    {PRODUCT_ID, PR_ID_CTRL, PR_ID_CMD, PR_ID_LEN, PR_ID_DATA, offsetof(MmwaveDeviceInfo, product_id)},
+    {HARDWARE_MODEL, HW_MODEL_CTRL, HW_MODEL_CMD, HW_MODEL_LEN, HW_MODEL_DATA, offsetof(MmwaveDeviceInfo, hardware_model)},
+    {FIRMWARE_VERSION, FW_VERSION_CTRL, FW_VERSION_CMD, FW_VERSION_LEN, FW_VERSION_DATA,
+        offsetof(MmwaveDeviceInfo, firmware_version)}
+};
+
+static MmwaveDeviceInfo device_info; //cache - ostaje kroz deinicijalizaciju sustava
+static uint32_t device_info_valid; //bit i je postavljen ako je podatak i u cacheu
+static MutexHandle_t device_info_mutex = NULL; //štiti cache
+static PlatformStaticMutex_t device_info_mutex_buffer;
+
+/**
+ * @brief Kopira cache i vraća masku valjanih podataka.
+ * 
+ * @param out Pokazivač na strukturu za podatke
+ * @return Maska valjanih podataka
+ */
+static uint32_t device_info_copy(MmwaveDeviceInfo* out)
+{
+    uint32_t valid = 0;
+    if(platform_lock_mutex(device_info_mutex, MUTEX_WAIT_FOREVER) == MUTEX_OP_SUCCESSFUL) {
+        *out = device_info;
+        valid = __atomic_load_n(&device_info_valid, __ATOMIC_ACQUIRE);
+        platform_unlock_mutex(device_info_mutex);
+    }
+    return valid;
+}
+
+bool app_device_info_init(void)
+{
+    device_info_mutex = platform_create_mutex_static(&device_info_mutex_buffer);
+    return device_info_mutex != NULL;
+}
+
+void app_device_info_deinit(void)
+{
+    if(device_info_mutex) {
+        platform_delete_mutex(device_info_mutex);
+        device_info_mutex = NULL;
+    }
+}
+
+void app_device_info_on_response(const DecodedResponse* response)
+{
+    if(response->type == MODULE_RESET) {
+        app_device_info_invalidate();
+        return;
+    }
+    for(size_t i = 0; i < DEVICE_INFO_FIELD_COUNT; i++) {
+        if(response->type != device_info_fields[i].type) {
+            continue;
+        }
+        size_t len = (response->data_l < APP_DEVICE_INFO_MAX_LEN) ? response->data_l : APP_DEVICE_INFO_MAX_LEN;
+        if(platform_lock_mutex(device_info_mutex, MUTEX_WAIT_FOREVER) == MUTEX_OP_SUCCESSFUL) {
+            char* field = (char*)&device_info + device_info_fields[i].offset;
+            memcpy(field, response->data, len);
+            field[len] = '\0';
+            __atomic_fetch_or(&device_info_valid, 1u << i, __ATOMIC_RELEASE);
+            platform_unlock_mutex(device_info_mutex);
+        }
+        return;
+    }
+}
+
+void app_device_info_request_missing(void)
+{
+    uint32_t valid = __atomic_load_n(&device_info_valid, __ATOMIC_ACQUIRE);
+    for(size_t i = 0; i < DEVICE_INFO_FIELD_COUNT; i++) {
+        if(!(valid & (1u << i))) {
+            const DeviceInfoField* info = &device_info_fields[i];
+            app_send_inquiry(&info->query_data, info->query_len, info->ctrl_w, info->cmd_w);
+        }
+    }
+}
+
+AppSensorStatus app_device_info_get(MmwaveDeviceInfo* out, uint32_t timeout_ms)
+{
+    if(!out) {
+        return APP_SENSOR_BAD_ARGUMENT;
+    }
+    if(!device_info_mutex) {
+        return APP_SENSOR_INVALID_STATE;
+    }
+    uint32_t valid = device_info_copy(out);
+    if(valid == DEVICE_INFO_ALL || timeout_ms == 0) {
+        return (valid == DEVICE_INFO_ALL) ? APP_SENSOR_OK : APP_SENSOR_TIMEOUT;
+    }
+
+    //podatci koji nedostaju traže se u jednom naletu, a odgovori pune cache (app_device_info_on_response)
+    AppRequestTicket requests[DEVICE_INFO_FIELD_COUNT];
+    bool submitted[DEVICE_INFO_FIELD_COUNT] = {false};
+    for(size_t i = 0; i < DEVICE_INFO_FIELD_COUNT; i++) {
+        if(!(valid & (1u << i))) {
+            const DeviceInfoField* info = &device_info_fields[i];
+            submitted[i] = app_request_submit(&info->query_data, info->query_len, info->ctrl_w, info->cmd_w,
+                timeout_ms, &requests[i]) == APP_SENSOR_OK;
+        }
+    }
+    for(size_t i = 0; i < DEVICE_INFO_FIELD_COUNT; i++) {
+        if(submitted[i]) {
+            app_request_wait(&requests[i], NULL);
+        }
+    }
+
+    valid = device_info_copy(out);
+    return (valid == DEVICE_INFO_ALL) ? APP_SENSOR_OK : APP_SENSOR_TIMEOUT;
+}
+
+void app_device_info_invalidate(void)
+{
+    //stringovi ostaju, ali bez bita valjanosti se ne koriste i prepisuju se novim odgovorima
+    __atomic_store_n(&device_info_valid, 0, __ATOMIC_RELEASE);
+}
\ No newline at end of file
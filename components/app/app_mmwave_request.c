@@ -0,0 +1,266 @@
+/**
+ * @file app_mmwave_request.c
+ * @author Marko Fuček
+ * @brief Implementacija tablice upita koji čekaju odgovor.
+ * 
+ * Implementacija funkcija zadanih u headeru app_mmwave_request.h.
+ * 
+ * Tablicu štiti mutex, a svako mjesto ima svoj bit u grupi signala na koji čekaju pozivatelji. Ponovno
+ * slanje obavlja pozivatelj koji čeka (izvan locka), pa za upite nije potreban poseban task. Mjesto se
+ * oslobađa kada ga napusti zadnji pozivatelj koji na njega čeka.
+ * 
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+#include <string.h>
+#include "app/app_mmwave_request.h"
+#include "app/app_mmwave_manager.h"
+#include "platform/platform_mutex.h"
+#include "platform/platform_signal.h"
+#include "platform/platform_time.h"
+
+/**
+ * @enum PendingRequestState
+ * @brief Stanje mjesta u tablici upita.
+ * 
+ */
+typedef enum {
+    REQUEST_FREE, /**< Mjesto je slobodno */
+    REQUEST_PENDING, /**< Upit je poslan i čeka odgovor */
+    REQUEST_DONE /**< Odgovor je stigao, a pozivatelji ga još nisu svi preuzeli */
+} PendingRequestState;
+
+/**
+ * @struct PendingRequest
+ * @brief Upit koji čeka odgovor.
+ * 
+ */
+typedef struct {
+    PendingRequestState state; /**< Stanje mjesta */
+    uint8_t ctrl_w; /**< Control word upita i očekivanog odgovora */
+    uint8_t cmd_w; /**< Command word upita i očekivanog odgovora */
+    uint8_t data[APP_REQUEST_MAX_DATA_LEN]; /**< Podatci upita (za ponovno slanje) */
+    uint8_t data_len; /**< Duljina podataka upita */
+    uint8_t retries_left; /**< Preostali broj ponovnih slanja */
+    uint8_t waiters; /**< Broj pozivatelja koji čekaju na upit */
+    uint32_t order; /**< Redni broj upita - odgovor se uparuje s najstarijim upitom */
+    uint32_t sent_ms; /**< Vrijeme zadnjeg slanja */
+    uint32_t retry_ms; /**< Čekanje od zadnjeg slanja do sljedećeg ponovnog slanja */
+    DecodedResponse response; /**< Primljeni odgovor */
+} PendingRequest;
+
+static PendingRequest requests[APP_MAX_PENDING_REQUESTS];
+static uint32_t next_order; //redni broj sljedećeg upita
+static MutexHandle_t request_mutex = NULL; //štiti tablicu upita
+static PlatformSignalHandle request_signal = NULL; //bit i je postavljen kada je stigao odgovor za mjesto i
+static PlatformStaticMutex_t request_mutex_buffer;
+static PlatformStaticSignal_t request_signal_buffer;
+
+/**
+ * @brief Provjerava je li vrijeme a isto ili kasnije od vremena b (uz preljev brojača ms).
+ * 
+ * @param a Vrijeme u ms
+ * @param b Vrijeme u ms
+ * @return true ako je a >= b
+ */
+static inline bool time_reached(uint32_t a, uint32_t b)
+{
+    return (int32_t)(a - b) >= 0;
+}
+
+/**
+ * @brief Pozivatelj napušta mjesto, a zadnji pozivatelj ga oslobađa.
+ * 
+ * @note Poziva se sa zauzetim request_mutex.
+ * 
+ * @param id Indeks mjesta
+ */
+static void request_release(int id)
+{
+    if(requests[id].waiters > 0) {
+        requests[id].waiters--;
+    }
+    if(requests[id].waiters == 0) {
+        requests[id].state = REQUEST_FREE;
+        platform_signal_clear(request_signal, (PlatformSignalBits)1 << id);
+    }
+}
+
+bool app_request_init(void)
+{
+    memset(requests, 0, sizeof(requests));
+    next_order = 0;
+    request_mutex = platform_create_mutex_static(&request_mutex_buffer);
+    request_signal = platform_signal_create_static(&request_signal_buffer);
+    if(!request_mutex || !request_signal) {
+        app_request_deinit();
+        return false;
+    }
+    return true;
+}
+
+void app_request_deinit(void)
+{
+    if(request_mutex) {
+        platform_delete_mutex(request_mutex);
+        request_mutex = NULL;
+    }
+    if(request_signal) {
+        platform_signal_delete(request_signal);
+        request_signal = NULL;
+    }
+    memset(requests, 0, sizeof(requests));
+}
+
+AppSensorStatus app_request_submit(const uint8_t* data, size_t data_len, uint8_t ctrl_w, uint8_t cmd_w,
+    uint32_t timeout_ms, AppRequestTicket* out_request)
+{
+    if(!data || data_len == 0 || data_len > APP_REQUEST_MAX_DATA_LEN || !out_request) {
+        return APP_SENSOR_BAD_ARGUMENT;
+    }
+    if(!request_mutex) {
+        return APP_SENSOR_INVALID_STATE;
+    }
+    if(platform_lock_mutex(request_mutex, MUTEX_WAIT_FOREVER) != MUTEX_OP_SUCCESSFUL) {
+        return APP_SENSOR_ERROR;
+    }
+    uint32_t now = platform_getNumOfMs();
+    int free_id = -1;
+    for(int i = 0; i < APP_MAX_PENDING_REQUESTS; i++) {
+        PendingRequest* req = &requests[i];
+        if(req->state == REQUEST_FREE) {
+            if(free_id < 0) {
+                free_id = i;
+            }
+            continue;
+        }
+        //isti upit već čeka odgovor - pridružujemo se umjesto ponovnog slanja
+        if(req->state == REQUEST_PENDING && req->ctrl_w == ctrl_w && req->cmd_w == cmd_w &&
+            req->data_len == data_len && memcmp(req->data, data, data_len) == 0) {
+            req->waiters++;
+            out_request->id = i;
+            out_request->deadline_ms = now + timeout_ms;
+            platform_unlock_mutex(request_mutex);
+            return APP_SENSOR_OK;
+        }
+    }
+    if(free_id < 0) {
+        platform_unlock_mutex(request_mutex);
+        return APP_SENSOR_BUSY;
+    }
+
+    PendingRequest* req = &requests[free_id];
+    req->ctrl_w = ctrl_w;
+    req->cmd_w = cmd_w;
+    memcpy(req->data, data, data_len);
+    req->data_len = (uint8_t)data_len;
+    req->retries_left = APP_REQUEST_RETRIES;
+    req->waiters = 1;
+    req->order = next_order++;
+    req->sent_ms = now;
+    req->retry_ms = APP_REQUEST_RETRY_MS;
+    platform_signal_clear(request_signal, (PlatformSignalBits)1 << free_id);
+    //mjesto je zauzeto prije slanja kako odgovor ne bi stigao prije nego ga tablica čeka
+    req->state = REQUEST_PENDING;
+    platform_unlock_mutex(request_mutex);
+
+    AppSensorStatus status = app_send_inquiry(data, data_len, ctrl_w, cmd_w);
+    if(status != APP_SENSOR_OK) {
+        platform_lock_mutex(request_mutex, MUTEX_WAIT_FOREVER);
+        request_release(free_id);
+        platform_unlock_mutex(request_mutex);
+        return status;
+    }
+    out_request->id = free_id;
+    out_request->deadline_ms = now + timeout_ms;
+    return APP_SENSOR_OK;
+}
+
+AppSensorStatus app_request_wait(const AppRequestTicket* request, DecodedResponse* out)
+{
+    if(!request || request->id < 0 || request->id >= APP_MAX_PENDING_REQUESTS || !request_mutex) {
+        return APP_SENSOR_BAD_ARGUMENT;
+    }
+    int id = request->id;
+    PendingRequest* req = &requests[id];
+    for(;;) {
+        if(platform_lock_mutex(request_mutex, MUTEX_WAIT_FOREVER) != MUTEX_OP_SUCCESSFUL) {
+            return APP_SENSOR_ERROR;
+        }
+        if(req->state == REQUEST_FREE) {
+            platform_unlock_mutex(request_mutex);
+            return APP_SENSOR_BAD_ARGUMENT;
+        }
+        if(req->state == REQUEST_DONE) {
+            if(out) {
+                *out = req->response;
+            }
+            request_release(id);
+            platform_unlock_mutex(request_mutex);
+            return APP_SENSOR_OK;
+        }
+
+        //pozivatelj čeka do svojeg roka - mjesto ostaje zauzeto dok čeka bilo koji od pozivatelja
+        uint32_t now = platform_getNumOfMs();
+        if(time_reached(now, request->deadline_ms)) {
+            request_release(id);
+            platform_unlock_mutex(request_mutex);
+            return APP_SENSOR_TIMEOUT;
+        }
+
+        //ponovno slanje - obavlja ga prvi pozivatelj koji primijeti da je vrijeme, ostali samo čekaju
+        bool resend = false;
+        uint8_t data[APP_REQUEST_MAX_DATA_LEN];
+        size_t data_len = req->data_len;
+        if(req->retries_left > 0 && time_reached(now, req->sent_ms + req->retry_ms)) {
+            req->retries_left--;
+            req->sent_ms = now;
+            req->retry_ms *= 2;
+            memcpy(data, req->data, data_len);
+            resend = true;
+        }
+        uint32_t wake_ms = request->deadline_ms;
+        if(req->retries_left > 0 && time_reached(wake_ms, req->sent_ms + req->retry_ms)) {
+            wake_ms = req->sent_ms + req->retry_ms;
+        }
+        uint8_t ctrl_w = req->ctrl_w;
+        uint8_t cmd_w = req->cmd_w;
+        platform_unlock_mutex(request_mutex);
+
+        if(resend) {
+            //neuspjelo slanje se ne prijavljuje - pokušava se ponovno do isteka roka
+            app_send_inquiry(data, data_len, ctrl_w, cmd_w);
+        }
+        platform_signal_wait(request_signal, (PlatformSignalBits)1 << id, false, false, wake_ms - now);
+    }
+}
+
+bool app_request_on_response(const DecodedResponse* response)
+{
+    if(!response || !request_mutex) {
+        return false;
+    }
+    if(platform_lock_mutex(request_mutex, MUTEX_WAIT_FOREVER) != MUTEX_OP_SUCCESSFUL) {
+        return false;
+    }
+    //odgovori stižu redom kojim su upiti poslani, pa se uparuje najstariji upit s istim ctrl_w i cmd_w
+    int match = -1;
+    for(int i = 0; i < APP_MAX_PENDING_REQUESTS; i++) {
+        PendingRequest* req = &requests[i];
+        if(req->state == REQUEST_PENDING && req->ctrl_w == response->ctrl_w && req->cmd_w == response->cmd_w &&
+            (match < 0 || (int32_t)(req->order - requests[match].order) < 0)) {
+            match = i;
+        }
+    }
+    if(match >= 0) {
+        requests[match].response = *response;
+        requests[match].state = REQUEST_DONE;
+        platform_signal_set(request_signal, (PlatformSignalBits)1 << match);
+    }
+    platform_unlock_mutex(request_mutex);
+    return match >= 0;
+}
\ No newline at end of file
@@ -0,0 +1,283 @@
+/**
+ * @file app_mmwave_scheduler.c
+ * @author Marko Fuček
+ * @brief Implementacija rasporeda periodičkih upita.
+ * 
+ * Implementacija funkcija zadanih u headeru app_mmwave_scheduler.h.
+ * 
+ * Raspored štiti mutex, a najranije dospijeće drži se i u atomarnoj varijabli, pa decoder task u prolazima
+ * u kojima ništa nije dospjelo ne zauzima lock. Frame upita izvodi se iz tablice odgovora
+ * (APP_MMWAVE_RESPONSE_TABLE), jer senzor na upit odgovara istim ctrl/cmd riječima.
+ * 
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+#include <string.h>
+#include "app/app_mmwave_scheduler.h"
+#include "app/app_mmwave_manager.h"
+#include "app/app_mmwave_constants.h"
+#include "platform/platform_mutex.h"
+#include "platform/platform_time.h"
+
+#define SCHEDULER_QUERY_DATA 0x0F //podatak svih upita koji čitaju vrijednost
+#define SCHEDULER_QUERY_LEN 1 //duljina podataka upita
+#define SCHEDULER_QUERY_CMD_BIT 0x80 //upiti koji čitaju vrijednost imaju postavljen najviši bit command worda
+
+/**
+ * @struct SchedulerQuery
+ * @brief Frame upita za jedan tip odgovora.
+ * 
+ */
+typedef struct {
+    AppInquiryType type; /**< Tip odgovora */
+    uint8_t ctrl_w; /**< Control word upita i odgovora */
+    uint8_t cmd_w; /**< Command word upita i odgovora */
+} SchedulerQuery;
+
+#define SCHEDULER_QUERY_ENTRY(ctrl, cmd, len, type) {type, (ctrl), (cmd)},
+
+//upiti i odgovori, generirani iz APP_MMWAVE_RESPONSE_TABLE (postavljanja se filtriraju kod dodavanja)
+static const SchedulerQuery scheduler_queries[] = {
+    APP_MMWAVE_RESPONSE_TABLE(SCHEDULER_QUERY_ENTRY)
+};
+
+/**
+ * @struct ScheduledInquiry
+ * @brief Upit u rasporedu.
+ * 
+ */
+typedef struct {
+    bool active; /**< Mjesto je zauzeto */
+    bool outstanding; /**< Odgovor na zadnje slanje još nije stigao */
+    AppInquiryType type; /**< Tip upita i očekivanog odgovora */
+    uint8_t ctrl_w; /**< Control word upita */
+    uint8_t cmd_w; /**< Command word upita */
+    uint32_t period_ms; /**< Period slanja */
+    uint32_t base_ms; /**< Dospijeće bez jittera (ne akumulira pomake) */
+    uint32_t due_ms; /**< Dospijeće s jitterom */
+    uint32_t sent_ms; /**< Vrijeme zadnjeg slanja */
+} ScheduledInquiry;
+
+static ScheduledInquiry scheduled[APP_MAX_SCHEDULED_INQUIRIES];
+static uint32_t scheduled_count; //broj upita u rasporedu - decoder task ga čita bez locka
+static uint32_t next_run_ms; //najranije dospijeće - decoder task ga čita bez locka
+static uint32_t jitter_state; //stanje xorshift generatora jittera
+static MutexHandle_t scheduler_mutex = NULL; //štiti raspored
+static PlatformStaticMutex_t scheduler_mutex_buffer;
+
+/**
+ * @brief Provjerava je li vrijeme a isto ili kasnije od vremena b (uz preljev brojača ms).
+ * 
+ * @param a Vrijeme u ms
+ * @param b Vrijeme u ms
+ * @return true ako je a >= b
+ */
+static inline bool time_reached(uint32_t a, uint32_t b)
+{
+    return (int32_t)(a - b) >= 0;
+}
+
+/**
+ * @brief Vraća slučajni pomak slanja (xorshift32).
+ * 
+ * @note Poziva se sa zauzetim scheduler_mutex.
+ * 
+ * @return Pomak u ms (0 - APP_SCHEDULER_JITTER_MS)
+ */
+static uint32_t scheduler_jitter(void)
+{
+    uint32_t x = jitter_state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    jitter_state = x;
+    return x % (APP_SCHEDULER_JITTER_MS + 1);
+}
+
+/**
+ * @brief Ponovno računa broj upita i najranije dospijeće.
+ * 
+ * @note Poziva se sa zauzetim scheduler_mutex.
+ * 
+ * @param now_ms Trenutno vrijeme u ms
+ */
+static void scheduler_update_next(uint32_t now_ms)
+{
+    uint32_t count = 0;
+    uint32_t next = now_ms + UINT32_MAX / 2;
+    for(int i = 0; i < APP_MAX_SCHEDULED_INQUIRIES; i++) {
+        if(scheduled[i].active) {
+            count++;
+            if(!time_reached(scheduled[i].due_ms, next)) {
+                next = scheduled[i].due_ms;
+            }
+        }
+    }
+    __atomic_store_n(&next_run_ms, next, __ATOMIC_RELEASE);
+    __atomic_store_n(&scheduled_count, count, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Traži frame upita za tip odgovora.
+ * 
+ * @param type Tip upita
+ * @return Pokazivač na frame upita ili NULL ako tip nije upit koji čita vrijednost
+ */
+static const SchedulerQuery* scheduler_find_query(AppInquiryType type)
+{
+    for(size_t i = 0; i < sizeof(scheduler_queries) / sizeof(scheduler_queries[0]); i++) {
+        const SchedulerQuery* query = &scheduler_queries[i];
+        if(query->type == type && ((query->cmd_w & SCHEDULER_QUERY_CMD_BIT) || type == HEARTBEAT)) {
+            return query;
+        }
+    }
+    return NULL;
+}
+
+bool app_scheduler_init(void)
+{
+    memset(scheduled, 0, sizeof(scheduled));
+    __atomic_store_n(&scheduled_count, 0, __ATOMIC_RELEASE);
+    jitter_state = platform_getNumOfMs() | 1; //xorshift ne smije krenuti od 0
+    scheduler_mutex = platform_create_mutex_static(&scheduler_mutex_buffer);
+    return scheduler_mutex != NULL;
+}
+
+void app_scheduler_deinit(void)
+{
+    __atomic_store_n(&scheduled_count, 0, __ATOMIC_RELEASE);
+    memset(scheduled, 0, sizeof(scheduled));
+    if(scheduler_mutex) {
+        platform_delete_mutex(scheduler_mutex);
+        scheduler_mutex = NULL;
+    }
+}
+
+AppSensorStatus app_scheduler_add(AppInquiryType type, uint32_t period_ms, int* out_id)
+{
+    const SchedulerQuery* query = scheduler_find_query(type);
+    if(!query || period_ms < APP_SCHEDULER_MIN_PERIOD_MS || period_ms > UINT32_MAX / 4) {
+        return APP_SENSOR_BAD_ARGUMENT;
+    }
+    if(!scheduler_mutex) {
+        return APP_SENSOR_INVALID_STATE;
+    }
+    if(platform_lock_mutex(scheduler_mutex, MUTEX_WAIT_FOREVER) != MUTEX_OP_SUCCESSFUL) {
+        return APP_SENSOR_ERROR;
+    }
+
+    uint32_t now = platform_getNumOfMs();
+    int id = -1;
+    for(int i = 0; i < APP_MAX_SCHEDULED_INQUIRIES; i++) {
+        if(scheduled[i].active && scheduled[i].type == type) {
+            //upit je već u rasporedu - mijenja se samo period
+            scheduled[i].period_ms = period_ms;
+            id = i;
+            break;
+        }
+        if(!scheduled[i].active && id < 0) {
+            id = i;
+        }
+    }
+    if(id >= 0 && !scheduled[id].active) {
+        scheduled[id] = (ScheduledInquiry){
+            .active = true,
+            .type = type,
+            .ctrl_w = query->ctrl_w,
+            .cmd_w = query->cmd_w,
+            .period_ms = period_ms,
+            .base_ms = now,
+            .due_ms = now
+        };
+    }
+    if(id >= 0) {
+        scheduler_update_next(now);
+    }
+    platform_unlock_mutex(scheduler_mutex);
+
+    if(id < 0) {
+        return APP_SENSOR_BUSY;
+    }
+    if(out_id) {
+        *out_id = id;
+    }
+    return APP_SENSOR_OK;
+}
+
+AppSensorStatus app_scheduler_remove(int id)
+{
+    if(id < 0 || id >= APP_MAX_SCHEDULED_INQUIRIES) {
+        return APP_SENSOR_BAD_ARGUMENT;
+    }
+    if(!scheduler_mutex) {
+        return APP_SENSOR_INVALID_STATE;
+    }
+    if(platform_lock_mutex(scheduler_mutex, MUTEX_WAIT_FOREVER) != MUTEX_OP_SUCCESSFUL) {
+        return APP_SENSOR_ERROR;
+    }
+    AppSensorStatus status = scheduled[id].active ? APP_SENSOR_OK : APP_SENSOR_BAD_ARGUMENT;
+    scheduled[id].active = false;
+    scheduler_update_next(platform_getNumOfMs());
+    platform_unlock_mutex(scheduler_mutex);
+    return status;
+}
+
+uint32_t app_scheduler_run(uint32_t now_ms)
+{
+    if(__atomic_load_n(&scheduled_count, __ATOMIC_ACQUIRE) == 0) {
+        return UINT32_MAX;
+    }
+    uint32_t next = __atomic_load_n(&next_run_ms, __ATOMIC_ACQUIRE);
+    if(!time_reached(now_ms, next)) {
+        return next - now_ms;
+    }
+    if(platform_lock_mutex(scheduler_mutex, MUTEX_WAIT_FOREVER) != MUTEX_OP_SUCCESSFUL) {
+        return APP_SCHEDULER_MIN_PERIOD_MS;
+    }
+
+    //svi upiti koji dospijevaju unutar prozora idu u isti nalet
+    const uint8_t data = SCHEDULER_QUERY_DATA;
+    for(int i = 0; i < APP_MAX_SCHEDULED_INQUIRIES; i++) {
+        ScheduledInquiry* inquiry = &scheduled[i];
+        if(!inquiry->active || !time_reached(now_ms + APP_SCHEDULER_MERGE_WINDOW_MS, inquiry->due_ms)) {
+            continue;
+        }
+        //dok prethodni upit čeka odgovor, novi bi samo produljio red u senzoru
+        bool waiting = inquiry->outstanding && !time_reached(now_ms, inquiry->sent_ms + APP_SCHEDULER_STALE_MS);
+        if(!waiting && app_send_inquiry(&data, SCHEDULER_QUERY_LEN, inquiry->ctrl_w, inquiry->cmd_w) == APP_SENSOR_OK) {
+            inquiry->outstanding = true;
+            inquiry->sent_ms = now_ms;
+        }
+        //propušteni periodi se ne nadoknađuju naletom upita
+        inquiry->base_ms += inquiry->period_ms;
+        if(time_reached(now_ms, inquiry->base_ms)) {
+            inquiry->base_ms = now_ms + inquiry->period_ms;
+        }
+        inquiry->due_ms = inquiry->base_ms + scheduler_jitter();
+    }
+    scheduler_update_next(now_ms);
+    platform_unlock_mutex(scheduler_mutex);
+
+    next = __atomic_load_n(&next_run_ms, __ATOMIC_ACQUIRE);
+    return time_reached(now_ms, next) ? 0 : next - now_ms;
+}
+
+void app_scheduler_on_response(const DecodedResponse* response)
+{
+    if(__atomic_load_n(&scheduled_count, __ATOMIC_ACQUIRE) == 0) {
+        return;
+    }
+    if(platform_lock_mutex(scheduler_mutex, MUTEX_WAIT_FOREVER) != MUTEX_OP_SUCCESSFUL) {
+        return;
+    }
+    for(int i = 0; i < APP_MAX_SCHEDULED_INQUIRIES; i++) {
+        if(scheduled[i].active && scheduled[i].type == response->type) {
+            scheduled[i].outstanding = false;
+        }
+    }
+    platform_unlock_mutex(scheduler_mutex);
+}
\ No newline at end of file
@@ -0,0 +1,112 @@
+/**
+ * @file app_mmwave_state.c
+ * @author Marko Fuček
+ * @brief Implementacija spremnika zadnjeg poznatog stanja senzora.
+ * 
+ * Implementacija funkcija zadanih u headeru app_mmwave_state.h.
+ * 
+ * Pisač drži privatnu radnu kopiju stanja. Kod ažuriranja ju mijenja, upisuje u neaktivni buffer
+ * (broj sekvence neparan tijekom upisa) i tek onda taj buffer proglašava aktivnim. Čitatelj kopira
+ * aktivni buffer i prihvaća kopiju ako je broj sekvence prije i poslije isti i paran.
+ * 
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+#include <string.h>
+#include "app/app_mmwave_state.h"
+#include "platform/platform_time.h"
+#include "app/app_mmwave_decoder.h"
+
+/**
+ * @struct StateBuffer
+ * @brief Jedan buffer stanja s brojem sekvence.
+ * 
+ */
+typedef struct {
+    uint32_t seq; /**< Neparan dok pisač piše u buffer */
+    MmwaveState state; /**< Kopija stanja */
+} StateBuffer;
+
+static StateBuffer buffers[2];
+static uint32_t active; //indeks buffera koji čitatelji kopiraju
+static MmwaveState working; //radna kopija pisača (koristi samo decoder task)
+
+void app_mmwave_state_reset(void)
+{
+    memset(&working, 0, sizeof(working));
+    memset(buffers, 0, sizeof(buffers));
+    __atomic_store_n(&active, 0, __ATOMIC_RELEASE);
+}
+
+void app_mmwave_state_update(const CompactReport* compact)
+{
+    if(compact == NULL) {
+        return;
+    }
+    DecodedReport decoded;
+    app_mmwave_decoder_expand_report(compact, &decoded);
+    const DecodedReport* report = &decoded;
+
+    uint32_t now = platform_getNumOfMs();
+    if(now == 0) {
+        now = 1; //0 je rezervirana za "nije primljeno"
+    }
+    if(report->has_init_completed_info) {
+        working.init_completed = report->init_completed_info;
+        working.init_completed_ms = now;
+    }
+    if(report->has_presence_info) {
+        working.presence = report->presence_info;
+        working.presence_ms = now;
+    }
+    if(report->has_motion_info) {
+        working.motion = report->motion_info;
+        working.motion_ms = now;
+    }
+    if(report->has_bmp_info) {
+        working.bmp = report->bmp_info;
+        working.bmp_ms = now;
+    }
+    if(report->has_proximity_info) {
+        working.proximity = report->proximity_info;
+        working.proximity_ms = now;
+    }
+    if(report->has_uof_report) {
+        working.uof = report->uof_rep;
+        working.uof_ms = now;
+    }
+    working.updates++;
+
+    //pišemo u neaktivni buffer - čitatelji aktivnog ne vide nedovršen upis
+    uint32_t next = __atomic_load_n(&active, __ATOMIC_RELAXED) ^ 1;
+    StateBuffer* buf = &buffers[next];
+    uint32_t seq = __atomic_load_n(&buf->seq, __ATOMIC_RELAXED);
+    __atomic_store_n(&buf->seq, seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE); //oznaka upisa vidljiva prije podataka
+    buf->state = working;
+    __atomic_store_n(&buf->seq, seq + 2, __ATOMIC_RELEASE);
+    __atomic_store_n(&active, next, __ATOMIC_RELEASE);
+}
+
+void app_mmwave_state_read(MmwaveState* out)
+{
+    if(out == NULL) {
+        return;
+    }
+    for(;;) {
+        const StateBuffer* buf = &buffers[__atomic_load_n(&active, __ATOMIC_ACQUIRE)];
+        uint32_t s1 = __atomic_load_n(&buf->seq, __ATOMIC_ACQUIRE);
+        if(s1 & 1) {
+            continue; //pisač je u međuvremenu završio jedno ažuriranje i piše u ovaj buffer - aktivan je sada drugi
+        }
+        *out = buf->state;
+        __atomic_thread_fence(__ATOMIC_ACQUIRE); //kopija završena prije ponovne provjere
+        if(__atomic_load_n(&buf->seq, __ATOMIC_RELAXED) == s1) {
+            return;
+        }
+    }
+}
\ No newline at end of file
@@ -14,25 +14,44 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <string.h>
 #include "app/app_network.h"
 #include "my_hal/system_monitor.h"
 #include "platform/platform.h"
 #include "app/app_mmwave.h"
 #include "app/app_network_packet_serializer.h"
 
-static volatile bool network_ready = false;
-static volatile bool end_flag = false;
-static volatile bool task_ended = false;
+static PlatformSignalHandle net_signal = NULL; //signali spojenosti na mrežu i zaustavljanja network taska
 static AppNetworkState current_state = APP_NETWORK_UNINIT;
 static task_handler send_task_h = NULL;
 static volatile uint32_t sent_responses = 0;
 static volatile uint32_t sent_reports = 0;
-static PlatformQueueHandle rx_queue = NULL;
+static PlatformRingHandle rx_ring = NULL;
+
+#define NETWORK_TASK_STACK_SIZE 10000 //veličina stacka network taska u bajtovima
+#define NETWORK_SEND_PERIOD_MS 100 //period slanja podataka dok je mreža spojena
+#define NETWORK_POLL_BATCH 16 //najveći broj eventova dohvaćenih iz cache-a jednim pozivom
+
+#define NET_SIGNAL_CONNECTED (1 << 0) //mreža je spremna za slanje
+#define NET_SIGNAL_STOP (1 << 1) //zahtjev za zaustavljanjem network taska
+#define NET_SIGNAL_ENDED (1 << 2) //network task je završio s radom
+#define NET_SIGNAL_TRACE_DUMP (1 << 3) //zatraženo slanje trace zapisa
+#define NET_SIGNAL_HELLO_PENDING (1 << 4) //hello paket još nije poslan nakon spajanja
+
+//Statička memorija za network task i RX ring - ponovljeni start/stop ne fragmentira heap
+static uint8_t send_task_stack[NETWORK_TASK_STACK_SIZE];
+static PlatformStaticTask_t send_task_buffer;
+static uint8_t rx_ring_storage[RX_RING_SIZE];
+static PlatformStaticRing_t rx_ring_buffer;
+static PlatformStaticSignal_t net_signal_buffer;
+static DecodedResponse response_batch[NETWORK_POLL_BATCH]; //serija response-ova (koristi samo network task)
+static CompactReport report_batch[NETWORK_POLL_BATCH]; //serija kompaktnih reporta (koristi samo network task)
 
 /**
  * @brief Prima network event od HAL sloja i povlači određene akcije.
  * 
- * Za NETWORK_EVENT_CONNECTED daje dozvolu aplikacijskom sloju da smije slati podatke preko mreže.
+ * Za NETWORK_EVENT_CONNECTED daje dozvolu aplikacijskom sloju da smije slati podatke preko mreže i
+ * traži slanje hello paketa.
  * Za NETWORK_EVENT_DISCONNECTED daje zastavicu za zaustavljanje slanja podataka.
  * 
  * @note Drugi eventi (error itd.) - TO-DO
@@ -42,85 +61,150 @@ static PlatformQueueHandle rx_queue = NULL;
 static void on_nw_event(NetworkEvent nw)
 {
     if(nw == NETWORK_EVENT_CONNECTED) {
-        network_ready = true;
+        platform_signal_set(net_signal, NET_SIGNAL_CONNECTED | NET_SIGNAL_HELLO_PENDING);
     } else if(nw == NETWORK_EVENT_DISCONNECTED) {
-        network_ready = false;
+        platform_signal_clear(net_signal, NET_SIGNAL_CONNECTED);
     } else {
         //TO-DO drugi eventi
     }
 }
 
+/**
+ * @brief Prima poruku sa servera od HAL sloja i sprema ju u RX ring.
+ * 
+ * Poruka se kopira jednom - iz buffera Web Socket drivera izravno u rezervirano mjesto u ringu, bez
+ * alokacije na heapu (platform i HAL sloj je prosljeđuju bez kopiranja).
+ * Ako u ringu nema mjesta, poruka se odbacuje.
+ * 
+ * @param data Pokazivač na primljene podatke
+ * @param len Duljina primljenih podataka u bajtovima
+ */
 static void on_nw_data_received(const uint8_t* data, size_t len)
 {
     if(!data || len == 0) return;
 
-    NetworkRxPacket packet;
-    MemoryOperationStatus status = platform_malloc(&(packet.data), len);
-    if(status != MEM_OK) {
+    void* slot;
+    if(platform_ring_reserve(rx_ring, &slot, len, 10) != QUEUE_OK) {
         return;
     }
+    memcpy(slot, data, len);
+    platform_ring_commit(rx_ring, slot);
+}
+
+/**
+ * @brief Šalje sve trenutne trace zapise serveru u PACKET_TRACE paketima i briše ringove.
+ * 
+ */
+static void send_trace_dump(void)
+{
+    PlatformTraceRecord_t records[TRACE_PACKET_MAX_RECORDS];
+    uint8_t trace_packet[sizeof(TracePacket_t)];
 
-    memcpy(packet.data, data, len);
-    packet.len = len;
+    platform_trace_set_enabled(false);
+    size_t total = platform_trace_count();
+    for(size_t first = 0; first < total; first += TRACE_PACKET_MAX_RECORDS) {
+        size_t count = platform_trace_copy(first, records, TRACE_PACKET_MAX_RECORDS);
+        int len = app_serialize_trace(records, count, trace_packet, sizeof(trace_packet));
+        if(len > 0) {
+            hal_network_send(trace_packet, len);
+        }
+    }
+    platform_trace_clear();
+    platform_trace_set_enabled(true);
+}
 
-    if(platform_queue_send(rx_queue, &packet, 10) != QUEUE_OK) {
-        platform_free(packet.data);
+/**
+ * @brief Šalje hello paket s podatcima o uređaju ako su svi u cacheu.
+ * 
+ * @return true ako je paket poslan
+ * @return false ako podatci o uređaju još nisu pročitani sa senzora
+ */
+static bool send_hello(void)
+{
+    //samo cache - network task ne smije čekati UART odgovor
+    MmwaveDeviceInfo info;
+    if(mmwave_get_device_info(&info, 0) != APP_SENSOR_OK) {
+        return false;
+    }
+    uint8_t hello_packet[sizeof(HelloPacket_t)];
+    int len = app_serialize_hello(&info, hello_packet, sizeof(hello_packet));
+    if(len > 0) {
+        hal_network_send(hello_packet, len);
+        PLATFORM_TRACE(PLATFORM_TRACE_NET_SEND, len);
     }
+    return true;
 }
 
 /**
  * @brief Task koji upravlja uzimanjem podataka iz cachea i slanjem preko mreže.
  * 
  * Ako je mreža spremna funkcija polla mmwave response i report objekte iz cache-a, serijalizira ih u paket,
- * te nakon provjere veličine šalje mrežom i zabilježava da su poslani.
+ * te nakon provjere veličine šalje mrežom i zabilježava da su poslani. Na zahtjev šalje i trace zapise, a nakon
+ * svakog spajanja hello paket (čim su podatci o uređaju u cacheu).
  * 
- * Task će se sam ugasiti i osloboditi zauzete resurse kada dobije flag od sustava.
+ * Task će se sam ugasiti i osloboditi zauzete resurse kada dobije signal NET_SIGNAL_STOP, a završetak javlja
+ * signalom NET_SIGNAL_ENDED (nakon toga blokira dok ga network_stop() ne obriše). Dok mreža nije spojena, task blokira na signalima spajanja i zaustavljanja.
  * 
  * @param arg Ne koristi se
  */
 static void network_send_task(void* arg)
 {
     for(;;) {
-        if(network_ready) {
-            if(app_get_mmwave_state() == APP_SENSOR_RUNNING) {
-                DecodedResponse response;
-                uint8_t res_packet[sizeof(ResponsePacket_t)];
-                while(mmwave_poll_response(&response, 0)) {
-                    int len = app_serialize_response(&response, res_packet, sizeof(res_packet));
+        PlatformSignalBits bits = platform_signal_get(net_signal);
+        if(bits & NET_SIGNAL_STOP) {
+            system_monitor_unregister_task(send_task_h);
+            platform_signal_set(net_signal, NET_SIGNAL_ENDED);
+            platform_park_task(); //task briše network_stop()
+        }
+        if(!(bits & NET_SIGNAL_CONNECTED)) {
+            //ako nam mreža nije spremna, čekamo connect (ili stop)
+            platform_signal_wait(net_signal, NET_SIGNAL_CONNECTED | NET_SIGNAL_STOP, false, false,
+                PLATFORM_SIGNAL_WAIT_FOREVER);
+            continue;
+        }
+        PLATFORM_TRACE(PLATFORM_TRACE_TASK_WAKE, bits);
+
+        if(bits & NET_SIGNAL_TRACE_DUMP) {
+            platform_signal_clear(net_signal, NET_SIGNAL_TRACE_DUMP);
+            send_trace_dump();
+        }
+
+        if(app_get_mmwave_state() == APP_SENSOR_RUNNING) {
+            if((bits & NET_SIGNAL_HELLO_PENDING) && send_hello()) {
+                platform_signal_clear(net_signal, NET_SIGNAL_HELLO_PENDING);
+            }
+
+            //cache se prazni u serijama - jedna sinkronizacija po seriji umjesto po eventu
+            uint8_t res_packet[sizeof(ResponsePacket_t)];
+            size_t n;
+            while((n = mmwave_poll_responses(response_batch, NETWORK_POLL_BATCH, 0)) > 0) {
+                for(size_t i = 0; i < n; i++) {
+                    int len = app_serialize_response(&response_batch[i], res_packet, sizeof(res_packet));
                     if(len > 0) {
                         hal_network_send(&res_packet, len); //poslali smo response HAL-u, a on na websocket
+                        PLATFORM_TRACE(PLATFORM_TRACE_NET_SEND, len);
                         sent_responses++;
                     }
                 }
+            }
 
-                DecodedReport report;
-                uint8_t rep_packet[sizeof(ReportPacket_t)];
-                while(mmwave_poll_report(&report, 0)) {
+            uint8_t rep_packet[sizeof(ReportPacket_t)];
+            DecodedReport report;
+            while((n = mmwave_poll_compact_reports(report_batch, NETWORK_POLL_BATCH, 0)) > 0) {
+                for(size_t i = 0; i < n; i++) {
+                    app_mmwave_decoder_expand_report(&report_batch[i], &report);
                     int len = app_serialize_report(&report, rep_packet, sizeof(rep_packet));
                     if(len > 0) {
-                        hal_network_send(&rep_packet, len); //poslali smo response HAL-u, a on na websocket
+                        hal_network_send(&rep_packet, len); //poslali smo report HAL-u, a on na websocket
+                        PLATFORM_TRACE(PLATFORM_TRACE_NET_SEND, len);
                         sent_reports++;
                     }
                 }
             }
-
-            if(end_flag) {
-                system_monitor_unregister_task(send_task_h);
-                task_ended = true;
-                send_task_h = NULL;
-                platform_delete_task(NULL);
-            }
-
-            platform_delay_task(100); //dajemo vrijeme IDLE tasku da se watchdog ne aktivira
-        } else {
-            platform_delay_task(100); //ako nam mreža nije spremna, čekamo connect
-            if(end_flag) {
-                system_monitor_unregister_task(send_task_h);
-                task_ended = true;
-                send_task_h = NULL;
-                platform_delete_task(NULL);
-            }
         }
+
+        //dajemo vrijeme IDLE tasku da se watchdog ne aktivira - stop prekida čekanje
+        platform_signal_wait(net_signal, NET_SIGNAL_STOP, true, false, NETWORK_SEND_PERIOD_MS);
     }
 }
 
@@ -132,7 +216,11 @@ AppNetworkStatus network_init(app_network_config conf)
     if(hal_network_init((hal_network_config*) &conf) != HAL_NETWORK_OK) {
         return APP_NETWORK_ERROR;
     }
-    rx_queue = platform_queue_create(RX_QUEUE_LEN, sizeof(NetworkRxPacket));
+    rx_ring = platform_ring_create_static(RX_RING_SIZE, rx_ring_storage, &rx_ring_buffer);
+    net_signal = platform_signal_create_static(&net_signal_buffer);
+    if(!rx_ring || !net_signal) {
+        return APP_NETWORK_ERROR;
+    }
     hal_bind_network_callback(&on_nw_event, &on_nw_data_received);
     current_state = APP_NETWORK_INIT;
     return APP_NETWORK_OK;
@@ -147,17 +235,17 @@ AppNetworkStatus network_start(void)
         return APP_NETWORK_ERROR;
     }
 
-    end_flag = false;
-    task_ended = false;
+    platform_signal_clear(net_signal, NET_SIGNAL_STOP | NET_SIGNAL_ENDED);
 
     TaskConfig_t cfg = {
         .task_function = network_send_task,
         .task_name = "net",
         .task_parameters = NULL,
         .task_priority = 6,
-        .task_stack = 10000
+        .task_stack = NETWORK_TASK_STACK_SIZE,
+        .task_core = PLATFORM_TASK_CORE_NETWORK
     };
-    send_task_h = platform_create_task(&cfg);
+    send_task_h = platform_create_task_static(&cfg, send_task_stack, &send_task_buffer);
     if(send_task_h == NULL) {
         return APP_NETWORK_ERROR;
     }
@@ -173,10 +261,10 @@ AppNetworkStatus network_stop(void)
         return APP_NETWORK_INVALID_STATE;
     }
 
-    end_flag = true;
-    while(task_ended == false) {
-        platform_delay_task(20);
-    }
+    platform_signal_set(net_signal, NET_SIGNAL_STOP);
+    platform_signal_wait(net_signal, NET_SIGNAL_ENDED, true, false, PLATFORM_SIGNAL_WAIT_FOREVER);
+    platform_delete_task(send_task_h);
+    send_task_h = NULL;
 
     if(hal_network_stop() != HAL_NETWORK_OK) {
         return APP_NETWORK_ERROR;
@@ -194,16 +282,11 @@ AppNetworkStatus network_uninit(void)
         return APP_NETWORK_ERROR;
     }
 
-    NetworkRxPacket p;
-    while(platform_get_num_of_queue_elements(rx_queue) != 0) {
-        platform_queue_get(rx_queue, &p, 0);
-        platform_free(&p.data);
-    }
-    platform_queue_delete(rx_queue);
+    platform_ring_delete(rx_ring);
+    rx_ring = NULL;
 
-    end_flag = false;
-    task_ended = false;
-    network_ready = false;
+    platform_signal_delete(net_signal);
+    net_signal = NULL;
 
     current_state = APP_NETWORK_UNINIT;
     return APP_NETWORK_OK;
@@ -219,26 +302,34 @@ void sent_via_network_statistics(uint32_t* reports, uint32_t* responses)
 //poruka se reže na veličinu buffera!
 bool network_poll_rx(uint8_t* out_buf, size_t buf_len, size_t* out_len, uint32_t timeout_in_ms)
 {
-    if(!rx_queue || !out_buf || !out_len) {
+    if(!rx_ring || !out_buf || !out_len) {
         return false;
     }
 
-    NetworkRxPacket packet;
-    if(platform_queue_get(rx_queue, &packet, timeout_in_ms) != QUEUE_OK) {
+    void* packet;
+    size_t packet_len;
+    if(platform_ring_peek(rx_ring, &packet, &packet_len, timeout_in_ms) != QUEUE_OK) {
         return false;
     }
 
     //ako je ono što je server poslao preveliko - odrezat ćemo "višak"
     size_t copy_len = 0;
-    if(packet.len > buf_len) {
+    if(packet_len > buf_len) {
         copy_len = buf_len;
     } else {
-        copy_len = packet.len;
+        copy_len = packet_len;
     }
 
-    memcpy(out_buf, packet.data, copy_len);
+    memcpy(out_buf, packet, copy_len);
     *out_len = copy_len;
 
-    platform_free(packet.data); //free paketa s heapa
+    platform_ring_release(rx_ring, packet); //vraćamo mjesto u ringu
     return true;
+}
+
+void network_request_trace_dump(void)
+{
+    if(net_signal != NULL) {
+        platform_signal_set(net_signal, NET_SIGNAL_TRACE_DUMP);
+    }
 }
\ No newline at end of file
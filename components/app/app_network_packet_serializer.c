@@ -50,11 +50,19 @@ int app_serialize_report(DecodedReport* report, uint8_t* packet, size_t packet_l
         .motion_info = (uint8_t) report->motion_info,
         .bmp_info = (int32_t) report->bmp_info,
         .proximity_info = (uint8_t) report->proximity_info,
+#if APP_UOF_NO_FLOAT
+        .existence_energy = (uint8_t) report->uof_rep.existence_energy,
+        .motion_energy = (uint8_t) report->uof_rep.motion_energy,
+        .static_distance_cm = report->uof_rep.static_distance_cm,
+        .motion_distance_cm = report->uof_rep.motion_distance_cm,
+        .motion_speed_cms = report->uof_rep.motion_speed_cms
+#else
         .existence_energy = (int32_t) report->uof_rep.existence_energy,
-        .static_distance = (float) report->uof_rep.static_distance,
+        .static_distance = report->uof_rep.static_distance,
         .motion_energy = (int32_t) report->uof_rep.motion_energy,
-        .motion_distance = (float) report->uof_rep.motion_distance,
-        .motion_speed = (float) report->uof_rep.motion_speed
+        .motion_distance = report->uof_rep.motion_distance,
+        .motion_speed = report->uof_rep.motion_speed
+#endif
     };
 
     ReportPacket_t report_packet = {
@@ -96,4 +104,58 @@ int app_serialize_response(DecodedResponse* response, uint8_t* packet, size_t pa
 
     memcpy(packet, (uint8_t*) &response_packet, total_size);
     return total_size;
+}
+
+int app_serialize_trace(const PlatformTraceRecord_t* records, size_t count, uint8_t* packet, size_t packet_len)
+{
+    if(records == NULL || packet == NULL || count > TRACE_PACKET_MAX_RECORDS) {
+        return -1;
+    }
+    size_t payload_size = sizeof(uint8_t) + count * sizeof(PlatformTraceRecord_t);
+    size_t total_size = sizeof(PacketHeader_t) + payload_size;
+    if(packet_len < total_size) {
+        return -1;
+    }
+
+    PacketHeader_t header = {
+        .version = PACKET_VERSION,
+        .type = PACKET_TRACE,
+        .timestamp = platform_getNumOfMs(),
+        .payload_len = (uint8_t) payload_size
+    };
+
+    memcpy(packet, (uint8_t*) &header, sizeof(PacketHeader_t));
+    packet[sizeof(PacketHeader_t)] = (uint8_t) count;
+    memcpy(packet + sizeof(PacketHeader_t) + 1, records, count * sizeof(PlatformTraceRecord_t));
+    return total_size;
+}
+
+int app_serialize_hello(const MmwaveDeviceInfo* info, uint8_t* packet, size_t packet_len)
+{
+    if(info == NULL || packet == NULL) {
+        return -1;
+    }
+    size_t total_size = sizeof(HelloPacket_t);
+    if(packet_len < total_size) {
+        return -1;
+    }
+
+    HelloPacket_t hello_packet = {
+        .header = {
+            .version = PACKET_VERSION,
+            .type = PACKET_HELLO,
+            .timestamp = platform_getNumOfMs(),
+            .payload_len = sizeof(HelloPacketPayload_t)
+        }
+    };
+    //stringovi su najviše APP_DEVICE_INFO_MAX_LEN znakova (bez nul znaka u paketu), a ostatak polja ostaje 0
+    HelloPacketPayload_t* payload = &hello_packet.hello_payload;
+    memcpy(payload->product_model, info->product_model, strnlen(info->product_model, APP_DEVICE_INFO_MAX_LEN));
+    memcpy(payload->product_id, info->product_id, strnlen(info->product_id, APP_DEVICE_INFO_MAX_LEN));
+    memcpy(payload->hardware_model, info->hardware_model, strnlen(info->hardware_model, APP_DEVICE_INFO_MAX_LEN));
+    memcpy(payload->firmware_version, info->firmware_version,
+        strnlen(info->firmware_version, APP_DEVICE_INFO_MAX_LEN));
+
+    memcpy(packet, (uint8_t*) &hello_packet, total_size);
+    return total_size;
 }
\ No newline at end of file
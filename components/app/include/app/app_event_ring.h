@@ -0,0 +1,113 @@
+/**
+ * @file app_event_ring.h
+ * @author Marko Fuček
+ * @brief Lock-free ring fiksnog kapaciteta za evente aplikacijskog sloja (report/response) spremljene po vrijednosti.
+ * 
+ * Ring sprema kopije eventova u unaprijed zauzetu memoriju, pa dodavanje eventa nikada ne alocira.
+ * Ring ima jednog pisača (decoder task) i proizvoljno mnogo čitatelja. Ni pisač ni čitatelji ne uzimaju
+ * lock - svaki slot nosi broj sekvence (seqlock) po kojem čitatelj prepoznaje je li kopija cijela, a
+ * čitatelji poziciju čitanja preuzimaju s compare-and-swap. Kad je ring pun, novi event prepisuje
+ * najstariji (overwrite-oldest), a čitatelj koji zaostane preskače prepisane evente.
+ * 
+ * Čekanje na event odvojeno je od samog ringa (wait/notify) - čitatelj čeka na signal, pa čitatelj koji
+ * dugo čeka nikada ne drži ništa što pisaču treba.
+ * 
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+#pragma once
+#include "stdio.h"
+#include "stdint.h"
+#include "stdbool.h"
+#include "platform/platform_signal.h"
+
+/**
+ * @struct AppEventRing_t
+ * @brief Kontrolna struktura ringa eventova.
+ * 
+ * Struktura se drži u statičkoj memoriji vlasnika ringa, a polja koristi isključivo implementacija.
+ * 
+ */
+typedef struct {
+    uint8_t* storage; /**< Memorija za capacity elemenata veličine elem_size */
+    uint32_t* seq; /**< Broj sekvence po slotu (neparan dok pisač piše, 2 * (pozicija + 1) kad je upis gotov) */
+    size_t elem_size; /**< Veličina jednog eventa u bajtovima */
+    uint32_t capacity; /**< Najveći broj eventova u ringu (potencija broja 2) */
+    uint32_t write_pos; /**< Ukupan broj upisanih eventova (mijenja samo pisač) */
+    uint32_t read_pos; /**< Pozicija sljedećeg eventa za čitanje (čitatelji ju pomiču s CAS) */
+    uint32_t overwritten; /**< Broj eventova prepisanih prije nego su pročitani */
+    PlatformSignalHandle signal; /**< Signal dostupnih podataka za blokirajuće čitanje */
+    PlatformStaticSignal_t signal_buffer; /**< Memorija signala */
+} AppEventRing_t;
+
+/**
+ * @brief Inicijalizira prazan ring nad memorijom koju osigurava pozivatelj.
+ * 
+ * @param ring Pokazivač na kontrolnu strukturu ringa
+ * @param storage Memorija ringa, veličine barem elem_size * capacity bajtova
+ * @param seq Memorija za brojeve sekvence, barem capacity elemenata
+ * @param elem_size Veličina jednog eventa u bajtovima
+ * @param capacity Najveći broj eventova u ringu - mora biti potencija broja 2
+ * @return true ako je ring inicijaliziran
+ * @return false ako su parametri neispravni ili signal nije stvoren
+ */
+bool app_event_ring_init(AppEventRing_t* ring, void* storage, uint32_t* seq, size_t elem_size, uint32_t capacity);
+
+/**
+ * @brief Briše signal ringa i odbacuje sve eventove u njemu.
+ * 
+ * @param ring Pokazivač na kontrolnu strukturu ringa
+ */
+void app_event_ring_deinit(AppEventRing_t* ring);
+
+/**
+ * @brief Kopira event u ring; ako je ring pun, prepisuje najstariji event.
+ * 
+ * Ne blokira, ne uzima lock i ne alocira - sigurno za poziv iz decoder taska.
+ * 
+ * @param ring Pokazivač na kontrolnu strukturu ringa
+ * @param elem Pokazivač na event veličine elem_size
+ * @return true ako je event dodan bez gubitka
+ * @return false ako je pritom prepisan nepročitani event (ili ring nije inicijaliziran)
+ * 
+ * @warning Ring podržava samo jednog pisača - push se smije pozivati iz samo jednog taska.
+ */
+bool app_event_ring_push(AppEventRing_t* ring, const void* elem);
+
+/**
+ * @brief Vadi najstariji event iz ringa i kopira ga pozivatelju.
+ * 
+ * Sigurno za istodobni poziv iz više taskova - svaki event dobiva točno jedan čitatelj.
+ * 
+ * @param ring Pokazivač na kontrolnu strukturu ringa
+ * @param out Pokazivač na memoriju veličine barem elem_size
+ * @param timeout_ms Najdulje čekanje na event u ms (0 za neblokirajuće čitanje)
+ * @return true ako je event izvađen
+ * @return false ako do isteka vremena nije bilo eventa
+ */
+bool app_event_ring_pop(AppEventRing_t* ring, void* out, uint32_t timeout_ms);
+
+/**
+ * @brief Vadi do max najstarijih eventova iz ringa jednom sinkronizacijom i kopira ih pozivatelju.
+ * 
+ * Čeka samo dok ring nije prazan - čim ima barem jedan event, vraća sve dostupne (najviše max) bez daljnjeg čekanja.
+ * 
+ * @param ring Pokazivač na kontrolnu strukturu ringa
+ * @param out Pokazivač na memoriju za barem max elemenata veličine elem_size
+ * @param max Najveći broj eventova za čitanje
+ * @param timeout_ms Najdulje čekanje na prvi event u ms (0 za neblokirajuće čitanje)
+ * @return Broj izvađenih eventova (0 ako do isteka vremena nije bilo eventa)
+ */
+size_t app_event_ring_pop_batch(AppEventRing_t* ring, void* out, size_t max, uint32_t timeout_ms);
+
+/**
+ * @brief Vraća broj eventova prepisanih od inicijalizacije ringa.
+ * 
+ * @param ring Pokazivač na kontrolnu strukturu ringa
+ * @return Broj prepisanih eventova
+ */
+uint32_t app_event_ring_overwritten(AppEventRing_t* ring);
\ No newline at end of file
@@ -20,6 +20,10 @@
 #include "app/app_mmwave_decoder.h"
 #include "app/app_mmwave_constants.h"
 #include "app/app_types.h"
+#include "app/app_mmwave_state.h"
+#include "app/app_mmwave_config.h"
+#include "app/app_mmwave_scheduler.h"
+#include "app/app_mmwave_device_info.h"
 
 /**
  * @brief Inicijalizira mmWave senzor i sustav koji njime upravlja.
@@ -66,6 +70,89 @@ AppSensorStatus mmwave_deinit(void);
  */
 AppSensorStatus registrate_onEvent_function(MMwaveResponseCallback res_fun, MMwaveReportCallback rep_fun);
 
+/**
+ * @brief Pretplaćuje vanjski program na eventove senzora (v2 callback API).
+ * 
+ * Za razliku od registrate_onEvent_function(), callbackovi dobivaju event preko pokazivača (bez kopije na stacku)
+ * i kontekst pretplatnika, pretplatnika može biti više (do APP_MAX_SUBSCRIBERS), a svaki se poziva samo za
+ * vrste eventova zadane maskom (npr. MMWAVE_EVENT_MASK_REPORT(REPORT_KIND_PRESENCE) | MMWAVE_EVENT_MASK_RESPONSE).
+ * Pretplate vrijede do mmwave_unsubscribe() ili deinicijalizacije sustava.
+ * 
+ * @param sub Pretplata (kopira se)
+ * @param out_id Identifikator pretplate za mmwave_unsubscribe()
+ * @return Status operacije (APP_SENSOR_BUSY ako nema slobodnog mjesta za pretplatnika)
+ */
+AppSensorStatus mmwave_subscribe(const MmwaveSubscription* sub, int* out_id);
+
+/**
+ * @brief Uklanja pretplatu dobivenu od mmwave_subscribe().
+ * 
+ * @param id Identifikator pretplate
+ * @return Status operacije
+ */
+AppSensorStatus mmwave_unsubscribe(int id);
+
+/**
+ * @brief Registrira callback koji se poziva kada senzor postane spreman za rad (poziva se prije mmwave_start()).
+ * 
+ * @param cb Callback (ili NULL za uklanjanje)
+ * @param user Kontekst koji se predaje callbacku
+ */
+void mmwave_register_ready_callback(MmwaveReadyCallback cb, void* user);
+
+/**
+ * @brief Provjerava je li senzor spreman za rad.
+ * 
+ * @return true ako je senzor javio završenu inicijalizaciju od zadnjeg mmwave_start()
+ * @return false inače
+ */
+bool mmwave_is_ready(void);
+
+/**
+ * @brief Blokira pozivatelja dok senzor ne postane spreman za rad.
+ * 
+ * Zamjenjuje fiksno čekanje nakon mmwave_start(): funkcija se vraća čim senzor javi završenu inicijalizaciju
+ * (report ili odgovor na upit koji se šalje svakih APP_READY_PROBE_MS), pa se postavke mogu slati odmah.
+ * 
+ * @param timeout_ms Najdulje čekanje u ms
+ * @return Status operacije (APP_SENSOR_TIMEOUT ako senzor nije postao spreman do isteka roka)
+ */
+AppSensorStatus mmwave_wait_ready(uint32_t timeout_ms);
+
+/**
+ * @brief Dodaje periodički upit u raspored upita managera.
+ * 
+ * Zamjenjuje vlastite petlje oko app_inquiry_* funkcija za vrijednosti koje senzor daje samo na upit.
+ * Upiti koji dospijevaju zajedno šalju se u jednom TX naletu, svako slanje pomiče se za mali slučajni
+ * pomak, a upit se ne šalje dok odgovor na prethodni nije stigao. Odgovori dolaze kao i ostali response-ovi.
+ * 
+ * @param type Tip upita (heartbeat ili upit koji čita vrijednost, npr. EXISTENCE_ENERGY, TIME_FOR_NO_PERSON_I)
+ * @param period_ms Period slanja u ms (najmanje APP_SCHEDULER_MIN_PERIOD_MS)
+ * @param out_id Identifikator za mmwave_unschedule_inquiry() (smije biti NULL)
+ * @return Status operacije (APP_SENSOR_BUSY ako je raspored pun)
+ */
+AppSensorStatus mmwave_schedule_inquiry(AppInquiryType type, uint32_t period_ms, int* out_id);
+
+/**
+ * @brief Uklanja periodički upit iz rasporeda.
+ * 
+ * @param id Identifikator dobiven od mmwave_schedule_inquiry()
+ * @return Status operacije
+ */
+AppSensorStatus mmwave_unschedule_inquiry(int id);
+
+/**
+ * @brief Dohvaća podatke o uređaju (product model, product ID, hardware model, firmware version).
+ * 
+ * Podatci se sa senzora čitaju jednom, kada senzor postane spreman, pa se nakon toga dohvaćaju iz cachea
+ * bez UART upita. Cache se briše kada senzor javi resetiranje.
+ * 
+ * @param out Pokazivač na strukturu za podatke
+ * @param timeout_ms Najdulje čekanje na podatke koji nisu u cacheu u ms (0 - samo cache)
+ * @return Status operacije (APP_SENSOR_TIMEOUT ako neki podatak nije dostupan)
+ */
+AppSensorStatus mmwave_get_device_info(MmwaveDeviceInfo* out, uint32_t timeout_ms);
+
 /**
  * @brief Omogućava dohvaćanje (polling) responsa iz mmWave senzora.
  * 
@@ -90,6 +177,90 @@ bool mmwave_poll_response(DecodedResponse* out, uint32_t timeout_ms);
  */
 bool mmwave_poll_report(DecodedReport* out, uint32_t timeout_ms);
 
+/**
+ * @brief Dohvaća snapshot zadnjeg poznatog stanja senzora.
+ * 
+ * Vraća zadnje primljene presence, motion, BMP, proximity i UOF vrijednosti s vremenom primitka svake od njih,
+ * bez pražnjenja ringa reporta. Ne blokira i ne uzima lock, pa se smije pozivati proizvoljno često.
+ * 
+ * @param out Pokazivač na strukturu u koju se kopira snapshot
+ * @return APP_SENSOR_OK ako je snapshot kopiran,
+ * @return APP_SENSOR_BAD_ARGUMENT ako je out NULL
+ */
+AppSensorStatus mmwave_get_state(MmwaveState* out);
+
+/**
+ * @brief Dohvaća (polling) do max responsa iz mmWave senzora jednom operacijom.
+ * 
+ * Wrapper funkcija koja prazni response-ove iz aplikacijskog sloja u seriji, uz jednu sinkronizaciju po pozivu.
+ * Čeka samo na prvi response - ostali dostupni vraćaju se odmah.
+ * 
+ * @param out Polje za barem max response struktura
+ * @param max Najveći broj response-ova za dohvat
+ * @param timeout_ms Najdulje čekanje na prvi response u ms
+ * @return Broj dohvaćenih response-ova (0 ako ih nije bilo)
+ */
+size_t mmwave_poll_responses(DecodedResponse* out, size_t max, uint32_t timeout_ms);
+
+/**
+ * @brief Dohvaća (polling) do max reporta iz mmWave senzora jednom operacijom.
+ * 
+ * Wrapper funkcija koja prazni reporte iz aplikacijskog sloja u seriji, uz jednu sinkronizaciju po pozivu.
+ * Čeka samo na prvi report - ostali dostupni vraćaju se odmah.
+ * 
+ * @param out Polje za barem max report struktura
+ * @param max Najveći broj reporta za dohvat
+ * @param timeout_ms Najdulje čekanje na prvi report u ms
+ * @return Broj dohvaćenih reporta (0 ako ih nije bilo)
+ */
+size_t mmwave_poll_reports(DecodedReport* out, size_t max, uint32_t timeout_ms);
+
+/**
+ * @brief Dohvaća (polling) do max reporta u kompaktnom obliku (vrsta + sirove vrijednosti), bez pretvorbe.
+ * 
+ * Namijenjeno potrošačima koji obrađuju velik broj reporta - u DecodedReport se pretvara po potrebi
+ * s app_mmwave_decoder_expand_report().
+ * 
+ * @param out Polje za barem max kompaktnih reporta
+ * @param max Najveći broj reporta za dohvat
+ * @param timeout_ms Najdulje čekanje na prvi report u ms
+ * @return Broj dohvaćenih reporta (0 ako ih nije bilo)
+ */
+size_t mmwave_poll_compact_reports(CompactReport* out, size_t max, uint32_t timeout_ms);
+
+/**
+ * @brief Primjenjuje cijeli profil postavki senzora kao jednu konfiguracijsku transakciju.
+ * 
+ * Sve postavke profila šalju se u jednom TX naletu, a funkcija se vraća čim senzor potvrdi (echo odgovorom)
+ * sve postavke ili neka od njih ne uspije. Zamjenjuje niz app_inquiry_*_set poziva i čekanje nakon njih.
+ * 
+ * @param profile Željeni profil postavki
+ * @param result Pokazivač na strukturu za potvrđene i neuspjele postavke (smije biti NULL)
+ * @param timeout_ms Najdulje čekanje na potvrdu svih postavki u ms
+ * @return Status operacije (APP_SENSOR_OK ako su sve postavke potvrđene)
+ */
+AppSensorStatus mmwave_apply_config(const MmwaveConfigProfile* profile, MmwaveConfigResult* result, uint32_t timeout_ms);
+
+/**
+ * @brief Usklađuje senzor s profilom postavki i šalje samo postavke koje se razlikuju.
+ * 
+ * Trenutne postavke senzora čitaju se iz cachea (puni se iz svih response-ova i ostaje valjan kroz
+ * mmwave_stop()/mmwave_deinit(), jer senzor pamti postavke), a nepoznate se dohvaćaju upitima. Nakon
+ * ponovnog pokretanja s istim profilom senzoru se ne šalje nijedna postavka.
+ * 
+ * @param profile Željeni profil postavki
+ * @param result Pokazivač na strukturu za potvrđene, neuspjele i preskočene postavke (smije biti NULL)
+ * @param timeout_ms Najdulje čekanje na odgovore u ms
+ * @return Status operacije (APP_SENSOR_OK ako senzor odgovara profilu)
+ */
+AppSensorStatus mmwave_sync_config(const MmwaveConfigProfile* profile, MmwaveConfigResult* result, uint32_t timeout_ms);
+
+/**
+ * @brief Briše cache postavki senzora (npr. nakon što je senzor mijenjan izvan ovog sustava).
+ * 
+ */
+void mmwave_config_invalidate_cache(void);
+
 /**
  * @brief Šalje upit (inquiry) za heartbeat na mmWave modul.
  * 
@@ -382,6 +553,162 @@ AppSensorStatus app_inquiry_cm_time_for_no_person_set(uint32_t time_in_ms);
  */
 AppSensorStatus app_inquiry_cm_time_for_no_person_get(void);
 
+/**
+ * @brief Šalje upit i čeka odgovor na njega (awaitable inquiry).
+ * 
+ * Upit se upisuje u tablicu upita koji čekaju odgovor, pa se može poslati više upita prije čekanja
+ * (pipelining): za svaki se pozove mmwave_request_submit(), a zatim mmwave_request_wait(). Isti upit koji
+ * već čeka odgovor se ne šalje ponovno, a upit bez odgovora se za vrijeme čekanja ponovno šalje (s
+ * udvostručenim razmakom). Response i dalje dolazi i u ring i callbackove.
+ * 
+ * @param data Pokazivač na podatke upita
+ * @param data_len Duljina podataka upita
+ * @param ctrl_w Control word upita i očekivanog odgovora
+ * @param cmd_w Command word upita i očekivanog odgovora
+ * @param timeout_ms Najdulje čekanje na odgovor u ms
+ * @param out_request Upit za mmwave_request_wait() (pamti i rok ovog pozivatelja)
+ * @return Status operacije (APP_SENSOR_BUSY ako previše upita već čeka odgovor)
+ */
+AppSensorStatus mmwave_request_submit(const uint8_t* data, size_t data_len, uint8_t ctrl_w, uint8_t cmd_w,
+    uint32_t timeout_ms, AppRequestTicket* out_request);
+
+/**
+ * @brief Blokira pozivatelja dok ne stigne odgovor na upit poslan s mmwave_request_submit().
+ * 
+ * @warning Ne smije se pozivati iz callbackova.
+ * 
+ * @param request Upit dobiven od mmwave_request_submit()
+ * @param out Pokazivač na strukturu u koju se kopira odgovor (smije biti NULL)
+ * @return APP_SENSOR_OK ako je odgovor stigao, APP_SENSOR_TIMEOUT ako nije stigao do roka pozivatelja
+ */
+AppSensorStatus mmwave_request_wait(const AppRequestTicket* request, DecodedResponse* out);
+
+/**
+ * @brief Šalje upit (inquiry) za heartbeat i čeka odgovor.
+ * 
+ * @param timeout_ms Najdulje čekanje na odgovor u ms
+ * @return Status operacije (APP_SENSOR_TIMEOUT ako odgovor nije stigao)
+ */
+AppSensorStatus app_inquiry_heartbeat_await(uint32_t timeout_ms);
+
+/**
+ * @brief Šalje upit (inquiry) za dohvat scene i čeka odgovor.
+ * 
+ * @param scene Pokazivač na mjesto za vrijednost iz odgovora (Scena)
+ * @param timeout_ms Najdulje čekanje na odgovor u ms
+ * @return Status operacije (APP_SENSOR_TIMEOUT ako odgovor nije stigao)
+ */
+AppSensorStatus app_inquiry_scene_settings_get_await(SceneMode* scene, uint32_t timeout_ms);
+
+/**
+ * @brief Šalje upit (inquiry) za dohvat sensitivity-a i čeka odgovor.
+ * 
+ * @param sensitivity Pokazivač na mjesto za vrijednost iz odgovora (Sensitivity)
+ * @param timeout_ms Najdulje čekanje na odgovor u ms
+ * @return Status operacije (APP_SENSOR_TIMEOUT ako odgovor nije stigao)
+ */
+AppSensorStatus app_inquiry_sensitivity_settings_get_await(SensitivityLevel* sensitivity, uint32_t timeout_ms);
+
+/**
+ * @brief Šalje upit (inquiry) za dohvat presence-a osobe i čeka odgovor.
+ * 
+ * @param presence Pokazivač na mjesto za vrijednost iz odgovora (Presence)
+ * @param timeout_ms Najdulje čekanje na odgovor u ms
+ * @return Status operacije (APP_SENSOR_TIMEOUT ako odgovor nije stigao)
+ */
+AppSensorStatus app_inquiry_presence_await(PresenceInfo* presence, uint32_t timeout_ms);
+
+/**
+ * @brief Šalje upit (inquiry) za dohvat motion-a i čeka odgovor.
+ * 
+ * @param motion Pokazivač na mjesto za vrijednost iz odgovora (Motion)
+ * @param timeout_ms Najdulje čekanje na odgovor u ms
+ * @return Status operacije (APP_SENSOR_TIMEOUT ako odgovor nije stigao)
+ */
+AppSensorStatus app_inquiry_motion_await(MotionInfo* motion, uint32_t timeout_ms);
+
+/**
+ * @brief Šalje upit (inquiry) za dohvat BMP-a i čeka odgovor.
+ * 
+ * @param bmp Pokazivač na mjesto za vrijednost iz odgovora (BMP)
+ * @param timeout_ms Najdulje čekanje na odgovor u ms
+ * @return Status operacije (APP_SENSOR_TIMEOUT ako odgovor nije stigao)
+ */
+AppSensorStatus app_inquiry_bmp_await(uint8_t* bmp, uint32_t timeout_ms);
+
+/**
+ * @brief Šalje upit (inquiry) za dohvat time-for-no-person i čeka odgovor.
+ * 
+ * @param time Pokazivač na mjesto za vrijednost iz odgovora (Time-for-no-person)
+ * @param timeout_ms Najdulje čekanje na odgovor u ms
+ * @return Status operacije (APP_SENSOR_TIMEOUT ako odgovor nije stigao)
+ */
+AppSensorStatus app_inquiry_time_for_no_person_get_await(TimeForNoPerson* time, uint32_t timeout_ms);
+
+/**
+ * @brief Šalje upit (inquiry) za dohvat proximity-a i čeka odgovor.
+ * 
+ * @param proximity Pokazivač na mjesto za vrijednost iz odgovora (Proximity)
+ * @param timeout_ms Najdulje čekanje na odgovor u ms
+ * @return Status operacije (APP_SENSOR_TIMEOUT ako odgovor nije stigao)
+ */
+AppSensorStatus app_inquiry_proximity_await(ProximityInfo* proximity, uint32_t timeout_ms);
+
+/**
+ * @brief Šalje upit (inquiry) za dohvat UOF output switch-a i čeka odgovor.
+ * 
+ * @param option Pokazivač na mjesto za vrijednost iz odgovora (Postavka output switch-a)
+ * @param timeout_ms Najdulje čekanje na odgovor u ms
+ * @return Status operacije (APP_SENSOR_TIMEOUT ako odgovor nije stigao)
+ */
+AppSensorStatus app_inquiry_uof_output_switch_get_await(OutputSwitch* option, uint32_t timeout_ms);
+
+/**
+ * @brief Šalje upit (inquiry) za dohvat custom mode-a i čeka odgovor.
+ * 
+ * @param mode_num Pokazivač na mjesto za vrijednost iz odgovora (Broj custom mode-a)
+ * @param timeout_ms Najdulje čekanje na odgovor u ms
+ * @return Status operacije (APP_SENSOR_TIMEOUT ako odgovor nije stigao)
+ */
+AppSensorStatus app_inquiry_cm_get_await(CustomMode* mode_num, uint32_t timeout_ms);
+
+/**
+ * @brief Šalje upit (inquiry) za dohvat threshold-a za existence i čeka odgovor.
+ * 
+ * @param existence_judgement_thresh Pokazivač na mjesto za vrijednost iz odgovora (Threshold za existence)
+ * @param timeout_ms Najdulje čekanje na odgovor u ms
+ * @return Status operacije (APP_SENSOR_TIMEOUT ako odgovor nije stigao)
+ */
+AppSensorStatus app_inquiry_cm_existence_judgement_thresh_get_await(uint8_t* existence_judgement_thresh, uint32_t timeout_ms);
+
+/**
+ * @brief Šalje upit (inquiry) za dohvat threshold-a za motion trigger i čeka odgovor.
+ * 
+ * @param motion_trigger_thresh Pokazivač na mjesto za vrijednost iz odgovora (Threshold za motion trigger)
+ * @param timeout_ms Najdulje čekanje na odgovor u ms
+ * @return Status operacije (APP_SENSOR_TIMEOUT ako odgovor nije stigao)
+ */
+AppSensorStatus app_inquiry_cm_motion_trigger_thresh_get_await(uint8_t* motion_trigger_thresh, uint32_t timeout_ms);
+
+/**
+ * @brief Šalje upit (inquiry) za dohvat existence perception bound-a i čeka odgovor.
+ * 
+ * @param bound Pokazivač na mjesto za vrijednost iz odgovora (Existence perception bound vrijednost)
+ * @param timeout_ms Najdulje čekanje na odgovor u ms
+ * @return Status operacije (APP_SENSOR_TIMEOUT ako odgovor nije stigao)
+ */
+AppSensorStatus app_inquiry_cm_existence_perception_bound_get_await(ExistencePerceptionBound* bound, uint32_t timeout_ms);
+
+/**
+ * @brief Šalje upit (inquiry) za dohvat motion trigger bound-a i čeka odgovor.
+ * 
+ * @param bound Pokazivač na mjesto za vrijednost iz odgovora (Motion trigger bound vrijednost)
+ * @param timeout_ms Najdulje čekanje na odgovor u ms
+ * @return Status operacije (APP_SENSOR_TIMEOUT ako odgovor nije stigao)
+ */
+AppSensorStatus app_inquiry_cm_motion_trigger_bound_get_await(MotionTriggerBound* bound, uint32_t timeout_ms);
+
+
 /**
  * @brief Ispisuje snapshot sustava sa svim podatcima o iskorištenju rečunalnih resursa u nekom momentu rada na serial monitor.
  * 
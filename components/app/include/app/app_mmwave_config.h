@@ -0,0 +1,133 @@
+/**
+ * @file app_mmwave_config.h
+ * @author Marko Fuček
+ * @brief Konfiguracijske transakcije - primjena cijelog profila postavki senzora odjednom.
+ * 
+ * Umjesto niza nezavisnih app_inquiry_*_set poziva i čekanja "dovoljno dugo", profil se primjenjuje
+ * kao jedna transakcija: svi frame-ovi postavki stavljaju se u TX queue jedan za drugim (jedan TX nalet),
+ * a zatim se čeka potvrda svake postavke. Senzor na postavku odgovara istim ctrl_w i cmd_w i postavljenom
+ * vrijednošću (echo), pa je postavka potvrđena kada echo odgovara traženoj vrijednosti. Funkcija se vraća
+ * čim su sve postavke potvrđene ili neuspjele, pa je vrijeme do konfiguriranog senzora najkraće moguće.
+ * 
+ * MR24HPC1 pamti postavke, pa modul drži i cache zadnjih poznatih postavki senzora. Cache se puni iz
+ * svih response-ova postavki (echo odgovori i odgovori na upite, neovisno o tome tko ih je poslao), a
+ * briše kod resetiranja modula. app_config_sync() upitima dohvaća samo postavke koje nisu u cacheu i šalje
+ * samo one koje se razlikuju od željenog profila.
+ * 
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+#pragma once
+#include "stdio.h"
+#include "stdint.h"
+#include "stdbool.h"
+#include "app/app_types.h"
+#include "app/app_mmwave_constants.h"
+
+/**
+ * @enum MmwaveConfigField
+ * @brief Postavke koje profil može sadržavati (bitovi maske).
+ * 
+ */
+typedef enum {
+    MMWAVE_CONFIG_SCENE = (1 << 0), /**< Scena */
+    MMWAVE_CONFIG_SENSITIVITY = (1 << 1), /**< Sensitivity */
+    MMWAVE_CONFIG_TIME_FOR_NO_PERSON = (1 << 2), /**< Time for no person (Standard Mode) */
+    MMWAVE_CONFIG_UOF_OUTPUT_SWITCH = (1 << 3), /**< UOF output switch (i mode sustava) */
+    MMWAVE_CONFIG_CM_EXISTENCE_JUDGMENT_THRESH = (1 << 4), /**< Threshold za existence (UOF Mode) */
+    MMWAVE_CONFIG_CM_MOTION_TRIGGER_THRESH = (1 << 5), /**< Threshold za motion trigger (UOF Mode) */
+    MMWAVE_CONFIG_CM_EXISTENCE_PERCEPTION_BOUND = (1 << 6), /**< Existence perception bound (UOF Mode) */
+    MMWAVE_CONFIG_CM_MOTION_TRIGGER_BOUND = (1 << 7) /**< Motion trigger bound (UOF Mode) */
+} MmwaveConfigField;
+
+#define MMWAVE_CONFIG_BASIC (MMWAVE_CONFIG_SCENE | MMWAVE_CONFIG_SENSITIVITY | MMWAVE_CONFIG_TIME_FOR_NO_PERSON | \
+    MMWAVE_CONFIG_UOF_OUTPUT_SWITCH) //maska osnovnih postavki profila
+
+#define MMWAVE_CONFIG_CUSTOM_MODE (MMWAVE_CONFIG_CM_EXISTENCE_JUDGMENT_THRESH | MMWAVE_CONFIG_CM_MOTION_TRIGGER_THRESH | \
+    MMWAVE_CONFIG_CM_EXISTENCE_PERCEPTION_BOUND | MMWAVE_CONFIG_CM_MOTION_TRIGGER_BOUND) //maska custom mode parametara
+
+#define MMWAVE_CONFIG_ALL (MMWAVE_CONFIG_BASIC | MMWAVE_CONFIG_CUSTOM_MODE) //maska svih postavki profila
+
+/**
+ * @struct MmwaveConfigProfile
+ * @brief Željeni profil postavki senzora.
+ * 
+ * Primjenjuju se samo postavke čiji je bit postavljen u fields.
+ * 
+ */
+typedef struct {
+    uint32_t fields; /**< Maska postavki koje se primjenjuju (MmwaveConfigField) */
+    SceneMode scene; /**< Scena */
+    SensitivityLevel sensitivity; /**< Sensitivity */
+    TimeForNoPerson time_for_no_person; /**< Time for no person (samo u Standard Mode) */
+    OutputSwitch uof_output_switch; /**< UOF output switch */
+    uint8_t existence_judgment_thresh; /**< Threshold za existence (0-250) */
+    uint8_t motion_trigger_thresh; /**< Threshold za motion trigger (0-250) */
+    ExistencePerceptionBound existence_perception_bound; /**< Existence perception bound */
+    MotionTriggerBound motion_trigger_bound; /**< Motion trigger bound */
+} MmwaveConfigProfile;
+
+/**
+ * @struct MmwaveConfigResult
+ * @brief Ishod konfiguracijske transakcije.
+ * 
+ */
+typedef struct {
+    uint32_t confirmed; /**< Maska postavki koje je senzor potvrdio */
+    uint32_t failed; /**< Maska postavki koje nisu potvrđene (nema odgovora ili echo ne odgovara) */
+    uint32_t skipped; /**< Maska postavki koje nisu poslane jer ih senzor već ima (samo app_config_sync) */
+    uint32_t elapsed_ms; /**< Trajanje transakcije od prvog slanja do zadnje potvrde u ms */
+} MmwaveConfigResult;
+
+/**
+ * @brief Primjenjuje profil postavki kao jednu transakciju.
+ * 
+ * Sve postavke profila šalju se jedna za drugom bez čekanja (jedan TX nalet), a zatim se čeka echo
+ * odgovor svake od njih. Postavke koje senzor prima samo u jednom modu (time for no person u Standard
+ * Mode, custom mode parametri u UOF Mode) šalju se nakon prebacivanja senzora u taj mode, a na kraju se
+ * senzor ostavlja u modu zadanom profilom (ili u početnom ako profil ne sadrži UOF output switch). Mode
+ * sustava mijenja se tek kada senzor potvrdi switch.
+ * 
+ * @param profile Željeni profil
+ * @param result Pokazivač na strukturu za ishod transakcije (smije biti NULL)
+ * @param timeout_ms Najdulje čekanje na potvrdu svih postavki u ms (uključujući ponovna slanja)
+ * @return APP_SENSOR_OK ako su sve postavke potvrđene,
+ * @return APP_SENSOR_TIMEOUT ako za neku postavku nije stigao odgovor,
+ * @return APP_SENSOR_ERROR ako echo neke postavke ne odgovara traženoj vrijednosti ili slanje nije uspjelo,
+ * @return APP_SENSOR_BAD_ARGUMENT ako profil sadrži neispravnu vrijednost
+ */
+AppSensorStatus app_config_apply(const MmwaveConfigProfile* profile, MmwaveConfigResult* result, uint32_t timeout_ms);
+
+/**
+ * @brief Usklađuje senzor s profilom i šalje samo postavke koje se razlikuju.
+ * 
+ * Postavke profila koje nisu u cacheu dohvaćaju se upitima poslanima u jednom naletu: prvo one koje ne ovise
+ * o modu (uključujući UOF output switch, prema kojem se usklađuje mode sustava), a zatim one koje senzor
+ * daje u trenutnom modu. Postavke koje se razlikuju od profila (ili ih nije moguće pročitati u trenutnom
+ * modu) primjenjuju se s app_config_apply(), a ostale se preskaču.
+ * 
+ * @param profile Željeni profil
+ * @param result Pokazivač na strukturu za ishod (smije biti NULL)
+ * @param timeout_ms Najdulje čekanje na odgovore u ms, posebno za upite i za primjenu postavki
+ * @return Status kao kod app_config_apply() (APP_SENSOR_OK i kada nije bilo potrebno ništa poslati)
+ */
+AppSensorStatus app_config_sync(const MmwaveConfigProfile* profile, MmwaveConfigResult* result, uint32_t timeout_ms);
+
+/**
+ * @brief Ažurira cache postavki iz dekodiranog response-a.
+ * 
+ * Poziva se iz decoder taska za svaki response, prije buđenja pozivatelja koji na njega čekaju.
+ * 
+ * @param response Pokazivač na dekodirani response
+ */
+void app_config_on_response(const DecodedResponse* response);
+
+/**
+ * @brief Briše cache postavki, pa sljedeći app_config_sync() ponovno čita sve postavke sa senzora.
+ * 
+ */
+void app_config_cache_invalidate(void);
\ No newline at end of file
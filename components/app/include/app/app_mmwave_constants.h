@@ -235,6 +235,16 @@
 #define ENDING_UART_UPGRADE_CMD 0x03
 #define ENDING_UART_UPGRADE_LEN 1
 
+/**
+ * @enum InitStatus
+ * @brief Initialization Status (odgovor na Initialization Status Inquiry)
+ * 
+ */
+typedef enum {
+    INIT_STATUS_NOT_COMPLETED = 0x00, /**< Initialization not completed */
+    INIT_STATUS_COMPLETED = 0x01 /**< Initialization completed */
+} InitStatus;
+
 /**
  * @enum SceneMode
  * @brief Scene Mode Data
@@ -502,6 +512,63 @@ typedef enum {
 #define CM_UOF_TIME_FOR_NO_PERSON_I_LEN 1
 #define CM_UOF_TIME_FOR_NO_PERSON_I_DATA 0x0F
 
+/**
+ * @brief Duljina payloada odgovora koja nije fiksna (tekstualni podatci o uređaju, do MAX_RESPONSE_DATA_LEN).
+ * 
+ */
+#define RESPONSE_LEN_VARIABLE 0xFF
+
+/**
+ * @brief Tablica odgovora senzora (X-macro): X(ctrl, cmd, duljina payloada, AppInquiryType).
+ * 
+ * Iz ove tablice dekoder pri prevođenju generira tablicu za dohvat po ctrl/cmd paru u O(1).
+ * Novi response dodaje se samo novim redom u tablici.
+ * 
+ * @note Parovi ctrl/cmd moraju biti jedinstveni i razlikovati se u (ctrl & 0x0F) za različite ctrl riječi.
+ */
+#define APP_MMWAVE_RESPONSE_TABLE(X) \
+    X(HEARTBEAT_CTRL, HEARTBEAT_CMD, HEARTBEAT_LEN, HEARTBEAT) \
+    X(MODULE_RESET_CTRL, MODULE_RESET_CMD, MODULE_RESET_LEN, MODULE_RESET) \
+    X(PR_MODEL_CTRL, PR_MODEL_CMD, RESPONSE_LEN_VARIABLE, PRODUCT_MODEL) \
+    X(PR_ID_CTRL, PR_ID_CMD, RESPONSE_LEN_VARIABLE, PRODUCT_ID) \
+    X(HW_MODEL_CTRL, HW_MODEL_CMD, RESPONSE_LEN_VARIABLE, HARDWARE_MODEL) \
+    X(FW_VERSION_CTRL, FW_VERSION_CMD, RESPONSE_LEN_VARIABLE, FIRMWARE_VERSION) \
+    X(INIT_STATUS_I_CTRL, INIT_STATUS_I_CMD, INIT_STATUS_I_LEN, INIT_STATUS) \
+    X(SCENE_SETTINGS_CTRL, SCENE_SETTINGS_CMD, SCENE_SETTINGS_LEN, SCENE_SETTINGS) \
+    X(SCENE_SETTINGS_I_CTRL, SCENE_SETTINGS_I_CMD, SCENE_SETTINGS_I_LEN, SCENE_SETTINGS_I) \
+    X(SENSITIVITY_SETTINGS_I_CTRL, SENSITIVITY_SETTINGS_I_CMD, SENSITIVITY_SETTINGS_I_LEN, SENSITIVITY_I) \
+    X(SENSITIVITY_SETTINGS_CTRL, SENSITIVITY_SETTINGS_CMD, SENSITIVITY_SETTINGS_LEN, SENSITIVITY) \
+    X(PRESENCE_INFO_I_CTRL, PRESENCE_INFO_I_CMD, PRESENCE_INFO_I_LEN, PRESENCE) \
+    X(MOTION_INFO_I_CTRL, MOTION_INFO_I_CMD, MOTION_INFO_I_LEN, MOTION) \
+    X(BMP_INFO_I_CTRL, BMP_INFO_I_CMD, BMP_INFO_I_LEN, BMP) \
+    X(TIME_FOR_NO_PERSON_I_CTRL, TIME_FOR_NO_PERSON_I_CMD, TIME_FOR_NO_PERSON_I_LEN, TIME_FOR_NO_PERSON_I) \
+    X(TIME_FOR_NO_PERSON_SETTING_CTRL, TIME_FOR_NO_PERSON_SETTING_CMD, TIME_FOR_NO_PERSON_SETTING_LEN, TIME_FOR_NO_PERSON) \
+    X(PROXIMITY_INFO_I_CTRL, PROXIMITY_INFO_I_CMD, PROXIMITY_INFO_I_LEN, PROXIMITY) \
+    X(UOF_OUTPUT_SWITCH_CTRL, UOF_OUTPUT_SWITCH_CMD, UOF_OUTPUT_SWITCH_LEN, OUTPUT_SWITCH) \
+    X(UOF_OUTPUT_SWITCH_I_CTRL, UOF_OUTPUT_SWITCH_I_CMD, UOF_OUTPUT_SWITCH_I_LEN, OUTPUT_SWITCH_I) \
+    X(UOF_EXISTENCE_ENERGY_I_CTRL, UOF_EXISTENCE_ENERGY_I_CMD, UOF_EXISTENCE_ENERGY_I_LEN, EXISTENCE_ENERGY) \
+    X(UOF_MOTION_ENERGY_I_CTRL, UOF_MOTION_ENERGY_I_CMD, UOF_MOTION_ENERGY_I_LEN, MOTION_ENERGY) \
+    X(UOF_STATIC_DISTANCE_I_CTRL, UOF_STATIC_DISTANCE_I_CMD, UOF_STATIC_DISTANCE_I_LEN, STATIC_DISTANCE) \
+    X(UOF_MOTION_DISTANCE_I_CTRL, UOF_MOTION_DISTANCE_I_CMD, UOF_MOTION_DISTANCE_I_LEN, MOTION_DISTANCE) \
+    X(UOF_MOTION_SPEED_I_CTRL, UOF_MOTION_SPEED_I_CMD, UOF_MOTION_SPEED_I_LEN, MOTION_SPEED) \
+    X(CM_SETTING_CTRL, CM_SETTING_CMD, CM_SETTING_LEN, CUSTOM_MODE) \
+    X(CM_SETTING_END_CTRL, CM_SETTING_END_CMD, CM_SETTING_END_LEN, CUSTOM_MODE_END) \
+    X(CM_Q_CTRL, CM_Q_CMD, CM_Q_LEN, CUSTOM_MODE_I) \
+    X(CM_UOF_EXISTENCE_JUDGMENT_THRESH_I_CTRL, CM_UOF_EXISTENCE_JUDGMENT_THRESH_I_CMD, CM_UOF_EXISTENCE_JUDGMENT_THRESH_I_LEN, EXISTENCE_JUDGMENT_THRESH_I) \
+    X(CM_UOF_MOTION_TRIGGER_THRESH_I_CTRL, CM_UOF_MOTION_TRIGGER_THRESH_I_CMD, CM_UOF_MOTION_TRIGGER_THRESH_I_LEN, MOTION_TRIGGER_THRESH_I) \
+    X(CM_UOF_EXISTENCE_PERCEPTION_BOUND_I_CTRL, CM_UOF_EXISTENCE_PERCEPTION_BOUND_I_CMD, CM_UOF_EXISTENCE_PERCEPTION_BOUND_I_LEN, EXISTENCE_PERCEPTION_BOUND_I) \
+    X(CM_UOF_MOTION_TRIGGER_BOUND_I_CTRL, CM_UOF_MOTION_TRIGGER_BOUND_I_CMD, CM_UOF_MOTION_TRIGGER_BOUND_I_LEN, MOTION_TRIGGER_BOUND_I) \
+    X(CM_UOF_MOTION_TRIGGER_TIME_I_CTRL, CM_UOF_MOTION_TRIGGER_TIME_I_CMD, CM_UOF_MOTION_TRIGGER_TIME_I_LEN, MOTION_TRIGGER_TIME_I) \
+    X(CM_UOF_MOTION_TO_STILL_TIME_I_CTRL, CM_UOF_MOTION_TO_STILL_TIME_I_CMD, CM_UOF_MOTION_TO_STILL_TIME_I_LEN, MOTION_TO_STILL_TIME_I) \
+    X(CM_UOF_TIME_FOR_NO_PERSON_I_CTRL, CM_UOF_TIME_FOR_NO_PERSON_I_CMD, CM_UOF_TIME_FOR_NO_PERSON_I_LEN, CM_TIME_FOR_NO_PERSON_I) \
+    X(CM_EXISTENCE_JUDGMENT_THRESH_CTRL, CM_EXISTENCE_JUDGMENT_THRESH_CMD, CM_EXISTENCE_JUDGMENT_THRESH_LEN, EXISTENCE_JUDGMENT_THRESH) \
+    X(CM_MOTION_TRIGGER_THRESH_CTRL, CM_MOTION_TRIGGER_THRESH_CMD, CM_MOTION_TRIGGER_THRESH_LEN, MOTION_TRIGGER_THRESH) \
+    X(CM_EXISTENCE_PERCEPTION_BOUND_CTRL, CM_EXISTENCE_PERCEPTION_BOUND_CMD, CM_EXISTENCE_PERCEPTION_BOUND_LEN, EXISTENCE_PERCEPTION_BOUND) \
+    X(CM_MOTION_TRIGGER_BOUND_CTRL, CM_MOTION_TRIGGER_BOUND_CMD, CM_MOTION_TRIGGER_BOUND_LEN, MOTION_TRIGGER_BOUND) \
+    X(CM_MOTION_TRIGGER_TIME_CTRL, CM_MOTION_TRIGGER_TIME_CMD, CM_MOTION_TRIGGER_TIME_LEN, MOTION_TRIGGER_TIME) \
+    X(CM_MOTION_TO_STILL_TIME_CTRL, CM_MOTION_TO_STILL_TIME_CMD, CM_MOTION_TO_STILL_TIME_LEN, MOTION_TO_STILL_TIME) \
+    X(CM_TIME_FOR_NO_PERSON_CTRL, CM_TIME_FOR_NO_PERSON_CMD, CM_TIME_FOR_NO_PERSON_LEN, CM_TIME_FOR_NO_PERSON)
+
 /**
  * @enum CustomMode
  * @brief Custom Mode Numbers
@@ -39,15 +39,15 @@
 typedef struct {
     /**
      * @brief Callback za slanje dekodiranog reporta.
-     * @param report Struktura dekodiranog reporta
+     * @param report Pokazivač na kompaktni report (vrijedi samo za vrijeme poziva)
      */
-    void (*sendReportCallback)(DecodedReport report);
+    void (*sendReportCallback)(const CompactReport* report);
 
     /**
      * @brief Callback za slanje dekodiranog responsea.
-     * @param response Struktura dekodiranog responsea
+     * @param response Pokazivač na dekodirani response (vrijedi samo za vrijeme poziva)
      */
-    void (*sendResponseCallback)(DecodedResponse response);
+    void (*sendResponseCallback)(const DecodedResponse* response);
 } AppDecoderContext;
 
 /**
@@ -77,5 +77,17 @@ void app_mmwave_decoder_deinit();
  * 
  * @param data Semantički korisni podatci jednog frame-a
  * @param data_len Duljina semantički korisnih podataka jednog frame-a
+ * 
+ * @note Podatci se samo čitaju i ne zadržavaju nakon povratka - smiju biti posuđeni (npr. frame u vlasništvu HAL-a).
+ */
+void app_mmwave_decoder_process_frame(const uint8_t* data, size_t data_len);
+
+/**
+ * @brief Pretvara kompaktni report u DecodedReport (kompatibilni oblik za vanjski API).
+ * 
+ * Postavlja zastavicu i vrijednost vrste koju report nosi, a UOF kodove pretvara u metre i m/s.
+ * 
+ * @param in Pokazivač na kompaktni report
+ * @param out Pokazivač na strukturu u koju se sprema DecodedReport
  */
-void app_mmwave_decoder_process_frame(uint8_t* data, size_t data_len);
\ No newline at end of file
+void app_mmwave_decoder_expand_report(const CompactReport* in, DecodedReport* out);
\ No newline at end of file
@@ -0,0 +1,88 @@
+/**
+ * @file app_mmwave_device_info.h
+ * @author Marko Fuček
+ * @brief Cache podataka o uređaju (product model, product ID, hardware model, firmware version).
+ * 
+ * Podatci o uređaju ne mijenjaju se tijekom rada, pa se sa senzora čitaju jednom - kada senzor postane
+ * spreman - a svaki sljedeći dohvat služi se iz cachea bez UART upita. Cache se puni iz response-ova
+ * (i onih na upite koje je poslala aplikacija), a briše se kada senzor javi resetiranje (MODULE_RESET).
+ * Kao i cache postavki, ostaje valjan kroz zaustavljanje i deinicijalizaciju sustava.
+ * 
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+#pragma once
+#include "stdio.h"
+#include "stdint.h"
+#include "stdbool.h"
+#include "app/app_types.h"
+
+#define APP_DEVICE_INFO_MAX_LEN 32 //najveća duljina jednog podatka o uređaju (dulji se skraćuju)
+
+/**
+ * @struct MmwaveDeviceInfo
+ * @brief Podatci o uređaju, kao nul-terminirani stringovi.
+ * 
+ */
+typedef struct {
+    char product_model[APP_DEVICE_INFO_MAX_LEN + 1]; /**< Product model */
+    char product_id[APP_DEVICE_INFO_MAX_LEN + 1]; /**< Product ID */
+    char hardware_model[APP_DEVICE_INFO_MAX_LEN + 1]; /**< Hardware model */
+    char firmware_version[APP_DEVICE_INFO_MAX_LEN + 1]; /**< Firmware version */
+} MmwaveDeviceInfo;
+
+/**
+ * @brief Inicijalizira pristup cacheu (sadržaj cachea se ne briše).
+ * 
+ * @return true ako je mutex cachea uspješno stvoren
+ * @return false inače
+ */
+bool app_device_info_init(void);
+
+/**
+ * @brief Deinicijalizira pristup cacheu (sadržaj cachea ostaje za sljedeću inicijalizaciju).
+ * 
+ */
+void app_device_info_deinit(void);
+
+/**
+ * @brief Ažurira cache iz dekodiranog response-a.
+ * 
+ * Poziva se iz decoder taska za svaki response, prije buđenja pozivatelja koji na njega čekaju.
+ * 
+ * @param response Pokazivač na dekodirani response
+ */
+void app_device_info_on_response(const DecodedResponse* response);
+
+/**
+ * @brief Šalje upite za podatke koji nisu u cacheu, bez čekanja odgovora.
+ * 
+ * Poziva se iz decoder taska kada senzor postane spreman - odgovori pune cache kada stignu.
+ * 
+ */
+void app_device_info_request_missing(void);
+
+/**
+ * @brief Dohvaća podatke o uređaju.
+ * 
+ * Ako su svi podatci u cacheu, vraća se odmah. Inače se podatci koji nedostaju traže upitima poslanima
+ * u jednom naletu i čeka se na njih najdulje timeout_ms (uz timeout 0 samo se provjerava cache).
+ * 
+ * @param out Pokazivač na strukturu za podatke
+ * @param timeout_ms Najdulje čekanje na odgovore u ms
+ * @return APP_SENSOR_OK ako su dohvaćeni svi podatci,
+ * @return APP_SENSOR_TIMEOUT ako neki podatak nije stigao do isteka roka (ostali su ipak upisani),
+ * @return APP_SENSOR_BAD_ARGUMENT ako je out NULL,
+ * @return APP_SENSOR_INVALID_STATE ako sustav nije inicijaliziran
+ */
+AppSensorStatus app_device_info_get(MmwaveDeviceInfo* out, uint32_t timeout_ms);
+
+/**
+ * @brief Briše cache podataka o uređaju.
+ * 
+ */
+void app_device_info_invalidate(void);
\ No newline at end of file
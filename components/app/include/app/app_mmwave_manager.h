@@ -34,6 +34,18 @@
  */
 #define APP_MAX_TASKS 10
 
+/**
+ * @brief Definira najveći broj istodobnih pretplatnika na eventove (v2 callback API).
+ * 
+ */
+#define APP_MAX_SUBSCRIBERS 4
+
+/**
+ * @brief Definira period slanja Initialization Status upita dok se čeka da senzor postane spreman (u ms).
+ * 
+ */
+#define APP_READY_PROBE_MS 100
+
 /**
  * @struct TaskStats
  * @brief Struktura koja predstavlja podatke o iskorištenim računalnim resursima određenog taska.
@@ -55,6 +67,14 @@ typedef struct {
     uint32_t largest_free_block; /**< Najveći slobodni kontinuirani blok heap memorije u bajtovima */
     uint32_t task_num; /**< Broj taskova u sustavu */
     TaskStats tasks[APP_MAX_TASKS]; /**< Polje s podatcima o iskorištenim računalnim resursima svih taskova */
+    uint32_t parse_avg_ns; /**< Prosječno trajanje parsiranja jednog RX chunka u ns */
+    uint32_t parse_max_ns; /**< Najdulje trajanje parsiranja jednog RX chunka u ns */
+    uint32_t decode_avg_ns; /**< Prosječno trajanje dekodiranja jednog frame-a u ns */
+    uint32_t decode_max_ns; /**< Najdulje trajanje dekodiranja jednog frame-a u ns */
+    uint32_t rx_thresh; /**< Trenutni UART RX threshold u bajtovima */
+    uint32_t rx_timeout; /**< Trenutni UART RX timeout u trajanju simbola */
+    uint32_t rx_wakeups_per_frame_x100; /**< Broj buđenja RX taska po frame-u pomnožen sa 100 */
+    uint32_t rx_overflows; /**< Broj preljeva UART ulaza (RX FIFO i RX buffer) od pokretanja */
     uint32_t timestamp; /**< Broj sekundi nakon pokretanja */
 } SystemSnapshot;
 
@@ -72,7 +92,7 @@ AppSensorStatus app_start_sys(void);
  * @brief Inicijalizira modul i priprema sustav za rad.
  * 
  * Funkcija dohvaća HAL konfiguraciju i mmWave core interface te kontekst s callbackovima koje
- * koristi aplication decoder. Interni queue-ovi za čuvanje dekodiranih response i report eventova
+ * koristi aplication decoder. Interni ringovi za čuvanje dekodiranih response i report eventova
  * stvaraju se u ovoj funkciji.Dodatno, resetira interne varijable i postavlja sustav u inicijalizirano stanje.
  * 
  * @return Status operacije nad modulom
@@ -83,7 +103,7 @@ AppSensorStatus app_init_sys(void);
  * @brief Zaustavlja rad sustava.
  * 
  * Funkcija zaustavlja rad HAL-a, čeka na završetak rada dekodera (graceful stop) te deinicijalizira
- * aplication decoder. Briše interne queue-ove i postavlja sustav u neinicijalizirano stanje.
+ * aplication decoder. Interni ringovi eventova ostaju sačuvani za ponovni start.
  * 
  * @return Status operacije nad modulom
  */
@@ -93,7 +113,7 @@ AppSensorStatus app_stop_sys(void);
  * @brief Deinicijalizira sustav.
  * 
  * Funkcija briše HAL konfiguraciju i mmWave core interface te kontekst s callbackovima koje
- * koristi aplication decoder. Resetira interne varijable i postavlja sustav u neinicijalizirano stanje.
+ * koristi aplication decoder. Briše interne ringove eventova, resetira interne varijable i postavlja sustav u neinicijalizirano stanje.
  * 
  * @return Status operacije nad modulom
  */
@@ -129,9 +149,75 @@ AppSensorStatus app_set_mode(SensorOperationMode mode);
 void mmwave_register_event_callback(MMwaveResponseCallback res_cb, MMwaveReportCallback rep_cb);
 
 /**
- * @brief Dohvaća response event iz queue-a.
+ * @brief Dodaje pretplatnika na eventove (v2 callback API).
+ * 
+ * Pretplatnik dobiva reporte i response-ove preko pokazivača, zajedno sa svojim kontekstom, i to samo
+ * za vrste eventova zadane maskom. Callbackovi se pozivaju iz decoder taska izvan locka, pa smiju
+ * pozivati app_subscribe() i app_unsubscribe().
+ * 
+ * @warning Callbackovi ne smiju blokirati - svaki pretplatnik usporava dekodiranje sljedećeg frame-a.
+ * 
+ * @param sub Pretplata (kopira se)
+ * @param out_id Identifikator pretplate za app_unsubscribe()
+ * @return APP_SENSOR_OK ako je pretplatnik dodan,
+ * @return APP_SENSOR_BAD_ARGUMENT ako pretplata nema callback ili masku,
+ * @return APP_SENSOR_INVALID_STATE ako sustav nije inicijaliziran,
+ * @return APP_SENSOR_BUSY ako je zauzeto svih APP_MAX_SUBSCRIBERS mjesta
+ */
+AppSensorStatus app_subscribe(const MmwaveSubscription* sub, int* out_id);
+
+/**
+ * @brief Uklanja pretplatnika na eventove.
+ * 
+ * Nakon povratka funkcije callbackovi pretplatnika više se ne pozivaju za nove eventove. Poziv koji je
+ * decoder task već započeo može završiti nakon povratka ako se funkcija ne zove iz samog callbacka.
+ * 
+ * @param id Identifikator dobiven od app_subscribe()
+ * @return Status operacije
+ */
+AppSensorStatus app_unsubscribe(int id);
+
+/**
+ * @brief Registrira callback koji se poziva kada senzor postane spreman za rad.
+ * 
+ * Registracija se radi prije app_start_sys(), jednako kao kod mmwave_register_event_callback().
+ * 
+ * @warning Callback se poziva iz decoder taska i ne smije blokirati (npr. čekati odgovor senzora).
  * 
- * Kopira response u poslanu strukturu i oslobađa memoriju koju je on zauzimao.
+ * @param cb Callback (ili NULL za uklanjanje)
+ * @param user Kontekst koji se predaje callbacku
+ */
+void app_register_ready_callback(MmwaveReadyCallback cb, void* user);
+
+/**
+ * @brief Provjerava je li senzor spreman za rad.
+ * 
+ * Senzor je spreman nakon Initialization Completed reporta ili odgovora na Initialization Status upit
+ * koji javlja završenu inicijalizaciju. Spremnost se briše kod pokretanja sustava i resetiranja senzora.
+ * 
+ * @return true ako je senzor spreman
+ * @return false inače
+ */
+bool app_is_ready(void);
+
+/**
+ * @brief Blokira pozivatelja dok senzor ne postane spreman za rad.
+ * 
+ * Senzor koji je već radio prije pokretanja sustava ne šalje Initialization Completed report, pa se dok
+ * se čeka svakih APP_READY_PROBE_MS šalje Initialization Status upit. Funkcija se vraća čim stigne
+ * report ili potvrdan odgovor, a ne nakon fiksnog čekanja.
+ * 
+ * @param timeout_ms Najdulje čekanje u ms
+ * @return APP_SENSOR_OK ako je senzor spreman,
+ * @return APP_SENSOR_TIMEOUT ako senzor nije postao spreman do isteka roka,
+ * @return APP_SENSOR_INVALID_STATE ako sustav nije pokrenut
+ */
+AppSensorStatus app_wait_ready(uint32_t timeout_ms);
+
+/**
+ * @brief Dohvaća najstariji response event iz ringa.
+ * 
+ * Kopira response po vrijednosti u poslanu strukturu - nema memorije koju bi trebalo oslobađati.
  * 
  * @param out_event Pokazivač na strukturu aplikacijskog response
  * @param timeout_ms Vrijeme čekanja u ms
@@ -141,9 +227,9 @@ void mmwave_register_event_callback(MMwaveResponseCallback res_cb, MMwaveReportC
 bool app_get_response(DecodedResponse* out_event, uint32_t timeout_ms);
 
 /**
- * @brief Dohvaća report event iz queue-a.
+ * @brief Dohvaća najstariji report event iz ringa.
  * 
- * Kopira report u poslanu strukturu i oslobađa memoriju koju je on zauzimao.
+ * Kopira report po vrijednosti u poslanu strukturu - nema memorije koju bi trebalo oslobađati.
  * 
  * @param out_event Pokazivač na strukturu aplikacijskog reporta
  * @param timeout_ms Vrijeme čekanja u ms
@@ -152,35 +238,65 @@ bool app_get_response(DecodedResponse* out_event, uint32_t timeout_ms);
  */
 bool app_get_report(DecodedReport* out_report, uint32_t timeout_ms);
 
+/**
+ * @brief Dohvaća do max najstarijih response eventova iz ringa jednom operacijom.
+ * 
+ * @param out_responses Polje za barem max response struktura
+ * @param max Najveći broj response-ova za dohvat
+ * @param timeout_ms Najdulje čekanje na prvi response u ms
+ * @return Broj dohvaćenih response-ova
+ */
+size_t app_get_responses(DecodedResponse* out_responses, size_t max, uint32_t timeout_ms);
+
+/**
+ * @brief Dohvaća do max najstarijih report eventova iz ringa jednom operacijom.
+ * 
+ * @param out_reports Polje za barem max report struktura
+ * @param max Najveći broj reporta za dohvat
+ * @param timeout_ms Najdulje čekanje na prvi report u ms
+ * @return Broj dohvaćenih reporta
+ */
+size_t app_get_reports(DecodedReport* out_reports, size_t max, uint32_t timeout_ms);
+
+/**
+ * @brief Dohvaća do max najstarijih reporta iz ringa u kompaktnom obliku, bez pretvorbe.
+ * 
+ * @param out_reports Polje za barem max kompaktnih reporta
+ * @param max Najveći broj reporta za dohvat
+ * @param timeout_ms Najdulje čekanje na prvi report u ms
+ * @return Broj dohvaćenih reporta
+ */
+size_t app_get_compact_reports(CompactReport* out_reports, size_t max, uint32_t timeout_ms);
+
 /**
  * @brief Funkcija koja se poziva kod response eventa.
  * 
  * Funkcija se poziva preko callbacka iz aplication decodera kod dekodiranja response eventa.
- * Funkcija na poziv stavlja event u interni queue u manageru, te, ako je zadan, poziva callback
+ * Funkcija na poziv stavlja event u interni ring u manageru, te, ako je zadan, poziva callback
  * vanjskog programa.
  * 
- * @note Funkcija se poziva preko callbacka iz decodera te dinamički alocira DecodedResponse
- * strukturu, u nju sprema kopiju one koju je dobila preko argumenta i sprema pokazivač na
- * tu memoriju u queue i poziva callback vanjskog programa.
+ * @note Funkcija se poziva preko callbacka iz decodera i kopira DecodedResponse po vrijednosti u
+ * unaprijed zauzeti ring (bez alokacije). Ako je ring pun, prepisuje se najstariji event. Pretplatnici
+ * dobivaju pokazivač na isti response, bez dodatne kopije.
  * 
- * @param response Response event struktura
+ * @param response Pokazivač na response event strukturu
  */
-void onResponse(DecodedResponse response);
+void onResponse(const DecodedResponse* response);
 
 /**
  * @brief Funkcija koja se poziva kod report eventa.
  * 
  * Funkcija se poziva preko callbacka iz aplication decodera kod dekodiranja report eventa.
- * Funkcija na poziv stavlja event u interni queue u manageru, te, ako je zadan, poziva callback
+ * Funkcija na poziv stavlja event u interni ring u manageru, te, ako je zadan, poziva callback
  * vanjskog programa.
  * 
- * @note Funkcija se poziva preko callbacka iz decodera te dinamički alocira DecodedReport
- * strukturu, u nju sprema kopiju one koju je dobila preko argumenta i sprema pokazivač na
- * tu memoriju u queue i poziva callback vanjskog programa.
+ * @note Funkcija se poziva preko callbacka iz decodera i kopira kompaktni report po vrijednosti u
+ * unaprijed zauzeti ring (bez alokacije). Ako je ring pun, prepisuje se najstariji event. Callback
+ * vanjskog programa i pretplatnici dobivaju report pretvoren u DecodedReport (jednom po reportu).
  * 
- * @param report Report event struktura
+ * @param report Pokazivač na kompaktni report
  */
-void onReport(DecodedReport report);
+void onReport(const CompactReport* report);
 
 /**
  * @brief Šalje aplikacisjki inquiry (upit) na mmWave modul.
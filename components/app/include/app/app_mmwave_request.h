@@ -0,0 +1,95 @@
+/**
+ * @file app_mmwave_request.h
+ * @author Marko Fuček
+ * @brief Tablica upita koji čekaju odgovor (pending requests) za uparivanje upita i response-ova.
+ * 
+ * Svaki poslani upit zauzima mjesto u tablici označeno očekivanim odgovorom (ctrl_w, cmd_w - senzor
+ * odgovara istim riječima). Kada decoder dekodira response, manager ga predaje tablici koja ga uparuje
+ * s najstarijim upitom koji čeka taj odgovor i budi samo taskove koji na njega čekaju.
+ * 
+ * Više upita može istodobno čekati odgovor (pipelining): pozivatelj prvo pošalje sve upite s
+ * app_request_submit(), a zatim na svaki čeka s app_request_wait(). Isti upit (jednaki ctrl_w, cmd_w i
+ * podatci) koji već čeka odgovor ne šalje se ponovno, već se novi pozivatelj pridružuje postojećem.
+ * Dok pozivatelj čeka, upit bez odgovora ponovno se šalje nakon APP_REQUEST_RETRY_MS, a svaki sljedeći
+ * put nakon dvostruko duljeg vremena (najviše APP_REQUEST_RETRIES puta).
+ * 
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+#pragma once
+#include "stdio.h"
+#include "stdint.h"
+#include "stdbool.h"
+#include "app/app_types.h"
+
+#define APP_MAX_PENDING_REQUESTS 16 //najveći broj upita koji istodobno čekaju odgovor (najviše 24 - bitovi grupe signala)
+#define APP_REQUEST_MAX_DATA_LEN 4 //najveća duljina podataka upita u bajtovima
+#define APP_REQUEST_RETRIES 2 //najveći broj ponovnih slanja upita bez odgovora
+#define APP_REQUEST_RETRY_MS 150 //čekanje prije prvog ponovnog slanja, udvostručuje se za svako sljedeće
+
+/**
+ * @brief Inicijalizira tablicu upita.
+ * 
+ * @return true ako su mutex i signali tablice uspješno stvoreni
+ * @return false inače
+ */
+bool app_request_init(void);
+
+/**
+ * @brief Deinicijalizira tablicu upita.
+ * 
+ * @warning Pozivatelj mora garantirati da niti jedan task više ne čeka na upit.
+ */
+void app_request_deinit(void);
+
+/**
+ * @brief Šalje upit i zauzima mjesto u tablici za njegov odgovor.
+ * 
+ * Ako isti upit već čeka odgovor, ne šalje se ponovno, već se pozivatelj pridružuje postojećem. Svaki
+ * pozivatelj zadržava svoj rok, a ponovna slanja (najviše APP_REQUEST_RETRIES) obavljaju pozivatelji
+ * koji još čekaju.
+ * Svaki uspješan poziv mora pratiti točno jedan poziv app_request_wait() s dobivenim upitom.
+ * 
+ * @param data Pokazivač na podatke upita
+ * @param data_len Duljina podataka upita (najviše APP_REQUEST_MAX_DATA_LEN)
+ * @param ctrl_w Control word upita i očekivanog odgovora
+ * @param cmd_w Command word upita i očekivanog odgovora
+ * @param timeout_ms Najdulje čekanje na odgovor od trenutka slanja, uključujući ponovna slanja
+ * @param out_request Upit (mjesto i rok pozivatelja) za app_request_wait()
+ * @return APP_SENSOR_OK ako je upit poslan ili pridružen postojećem,
+ * @return APP_SENSOR_BUSY ako nema slobodnog mjesta u tablici,
+ * @return status app_send_inquiry() ako slanje nije uspjelo
+ */
+AppSensorStatus app_request_submit(const uint8_t* data, size_t data_len, uint8_t ctrl_w, uint8_t cmd_w,
+    uint32_t timeout_ms, AppRequestTicket* out_request);
+
+/**
+ * @brief Blokira pozivatelja dok ne stigne odgovor na upit ili ne istekne rok pozivatelja.
+ * 
+ * Za vrijeme čekanja po potrebi ponovno šalje upit. Blokira samo pozivatelja - ostali upiti i
+ * decoder task rade neovisno.
+ * 
+ * @warning Ne smije se pozivati iz callbackova (decoder taska) jer bi čekao samog sebe.
+ * 
+ * @param request Upit dobiven od app_request_submit()
+ * @param out Pokazivač na strukturu u koju se kopira odgovor (smije biti NULL)
+ * @return APP_SENSOR_OK ako je odgovor stigao,
+ * @return APP_SENSOR_TIMEOUT ako odgovor nije stigao do isteka roka pozivatelja,
+ * @return APP_SENSOR_BAD_ARGUMENT ako upit nije ispravan
+ */
+AppSensorStatus app_request_wait(const AppRequestTicket* request, DecodedResponse* out);
+
+/**
+ * @brief Uparuje dekodirani response s upitom koji ga čeka.
+ * 
+ * Poziva se iz decoder taska za svaki response.
+ * 
+ * @param response Pokazivač na dekodirani response
+ * @return true ako je response uparen s upitom
+ * @return false ako ga nijedan upit nije čekao
+ */
+bool app_request_on_response(const DecodedResponse* response);
\ No newline at end of file
@@ -0,0 +1,91 @@
+/**
+ * @file app_mmwave_scheduler.h
+ * @author Marko Fuček
+ * @brief Raspored periodičkih upita (inquiry) na mmWave modul.
+ * 
+ * Neke vrijednosti senzor daje samo na upit (npr. UOF energije, time for no person, heartbeat). Umjesto
+ * vlastitih petlji oko app_inquiry_* funkcija, aplikacija zadaje parove (upit, period), a raspored ih
+ * šalje iz decoder taska, bez posebnog taska:
+ * - upiti koji dospijevaju unutar APP_SCHEDULER_MERGE_WINDOW_MS šalju se zajedno, u jednom TX naletu,
+ * - svako slanje pomiče se za slučajnih 0 - APP_SCHEDULER_JITTER_MS, kako se upiti ne bi poravnali
+ *   s naletima reporta senzora,
+ * - upit se preskače dok odgovor na prethodno slanje nije stigao (najdulje APP_SCHEDULER_STALE_MS).
+ * 
+ * Odgovori na raspoređene upite dolaze kao i ostali response-ovi (ring, callbackovi, pretplatnici).
+ * 
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+#pragma once
+#include "stdio.h"
+#include "stdint.h"
+#include "stdbool.h"
+#include "app/app_types.h"
+
+#define APP_MAX_SCHEDULED_INQUIRIES 8 //najveći broj raspoređenih upita
+#define APP_SCHEDULER_MIN_PERIOD_MS 100 //najkraći dopušteni period upita
+#define APP_SCHEDULER_MERGE_WINDOW_MS 50 //upiti koji dospijevaju unutar ovog prozora šalju se u istom naletu
+#define APP_SCHEDULER_JITTER_MS 20 //najveći slučajni pomak jednog slanja
+#define APP_SCHEDULER_STALE_MS 1000 //nakon koliko se upit bez odgovora smatra izgubljenim
+
+/**
+ * @brief Inicijalizira raspored upita (prazan).
+ * 
+ * @return true ako je mutex rasporeda uspješno stvoren
+ * @return false inače
+ */
+bool app_scheduler_init(void);
+
+/**
+ * @brief Deinicijalizira raspored upita i briše sve upite u njemu.
+ * 
+ */
+void app_scheduler_deinit(void);
+
+/**
+ * @brief Dodaje periodički upit u raspored.
+ * 
+ * Upit se prvi put šalje odmah (u sljedećem prolazu decoder taska). Ponovno dodavanje upita koji je već
+ * u rasporedu samo mu mijenja period.
+ * 
+ * @param type Tip upita (samo upiti koji čitaju vrijednost - heartbeat i *_I / info upiti)
+ * @param period_ms Period slanja u ms (najmanje APP_SCHEDULER_MIN_PERIOD_MS)
+ * @param out_id Identifikator za app_scheduler_remove() (smije biti NULL)
+ * @return APP_SENSOR_OK ako je upit dodan,
+ * @return APP_SENSOR_BAD_ARGUMENT ako tip nije upit ili je period prekratak,
+ * @return APP_SENSOR_INVALID_STATE ako raspored nije inicijaliziran,
+ * @return APP_SENSOR_BUSY ako je zauzeto svih APP_MAX_SCHEDULED_INQUIRIES mjesta
+ */
+AppSensorStatus app_scheduler_add(AppInquiryType type, uint32_t period_ms, int* out_id);
+
+/**
+ * @brief Uklanja upit iz rasporeda.
+ * 
+ * @param id Identifikator dobiven od app_scheduler_add()
+ * @return Status operacije
+ */
+AppSensorStatus app_scheduler_remove(int id);
+
+/**
+ * @brief Šalje upite koji su dospjeli.
+ * 
+ * Poziva se iz decoder taska prije svakog čekanja na frame. Dok nijedan upit nije dospio, funkcija se
+ * vraća bez zauzimanja locka.
+ * 
+ * @param now_ms Trenutno vrijeme u ms
+ * @return Vrijeme do sljedećeg dospijeća u ms (UINT32_MAX ako je raspored prazan)
+ */
+uint32_t app_scheduler_run(uint32_t now_ms);
+
+/**
+ * @brief Označava da je stigao odgovor na raspoređeni upit.
+ * 
+ * Poziva se iz decoder taska za svaki response.
+ * 
+ * @param response Pokazivač na dekodirani response
+ */
+void app_scheduler_on_response(const DecodedResponse* response);
\ No newline at end of file
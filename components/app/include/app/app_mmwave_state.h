@@ -0,0 +1,74 @@
+/**
+ * @file app_mmwave_state.h
+ * @author Marko Fuček
+ * @brief Spremnik zadnjeg poznatog stanja senzora (latest-state store).
+ * 
+ * Decoder task na svaki report ažurira zadnju vrijednost odgovarajućeg podatka (presence, motion, BMP,
+ * proximity, UOF) i vrijeme njezina primitka. Čitatelji dohvaćaju cijeli snapshot bez čekanja i bez
+ * prometa kroz ringove eventova, pa ga mogu čitati proizvoljno često.
+ * 
+ * Stanje se drži u dva buffera (double-buffer) od kojih svaki ima svoj broj sekvence (seqlock): pisač
+ * uvijek piše u neaktivni buffer pa ga objavljuje, a čitatelj kopira aktivni. Čitanje se ponavlja samo
+ * ako je pisač u međuvremenu završio dva cijela ažuriranja, pa čitatelj nikada ne čeka pisača.
+ * 
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+#pragma once
+#include "stdio.h"
+#include "stdint.h"
+#include "stdbool.h"
+#include "app/app_types.h"
+
+/**
+ * @struct MmwaveState
+ * @brief Snapshot zadnjeg poznatog stanja senzora.
+ * 
+ * Uz svaki podatak stoji vrijeme zadnjeg ažuriranja u ms od pokretanja sustava; 0 znači da podatak
+ * od inicijalizacije još nije primljen.
+ * 
+ */
+typedef struct {
+    bool init_completed; /**< Zadnji init completed info */
+    uint32_t init_completed_ms; /**< Vrijeme primitka init completed info */
+    PresenceInfo presence; /**< Zadnji presence info */
+    uint32_t presence_ms; /**< Vrijeme primitka presence info */
+    MotionInfo motion; /**< Zadnji motion info */
+    uint32_t motion_ms; /**< Vrijeme primitka motion info */
+    int bmp; /**< Zadnji BodyMotionParameter (BMP) */
+    uint32_t bmp_ms; /**< Vrijeme primitka BMP-a */
+    ProximityInfo proximity; /**< Zadnji proximity info */
+    uint32_t proximity_ms; /**< Vrijeme primitka proximity info */
+    uof_report uof; /**< Zadnji UOF report */
+    uint32_t uof_ms; /**< Vrijeme primitka UOF reporta */
+    uint32_t updates; /**< Ukupan broj ažuriranja od inicijalizacije */
+} MmwaveState;
+
+/**
+ * @brief Briše stanje - svi podatci postaju neprimljeni.
+ * 
+ * @note Ne smije se pozivati istodobno s app_mmwave_state_update() (poziva se iz init-a, prije pokretanja decoder taska).
+ */
+void app_mmwave_state_reset(void);
+
+/**
+ * @brief Ažurira stanje podatkom koji nosi kompaktni report.
+ * 
+ * @param compact Pokazivač na kompaktni report
+ * 
+ * @warning Spremnik podržava samo jednog pisača - poziva se isključivo iz decoder taska.
+ */
+void app_mmwave_state_update(const CompactReport* compact);
+
+/**
+ * @brief Kopira konzistentan snapshot zadnjeg stanja.
+ * 
+ * Ne blokira i ne uzima lock - sigurno za poziv iz bilo kojeg taska, proizvoljno često.
+ * 
+ * @param out Pokazivač na strukturu u koju se kopira snapshot
+ */
+void app_mmwave_state_read(MmwaveState* out);
\ No newline at end of file
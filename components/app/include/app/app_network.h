@@ -22,7 +22,11 @@
 #include "app/app_types.h"
 #include "my_hal/hal_network_interface.h"
 
-#define RX_QUEUE_LEN 20
+/**
+ * @brief Veličina (u bajtovima) byte-ring queue-a za poruke primljene sa servera.
+ * 
+ */
+#define RX_RING_SIZE 4096
 
 /**
  * @typedef app_network_config
@@ -31,11 +35,6 @@
  */
 typedef hal_network_config app_network_config;
 
-typedef struct {
-    uint8_t* data;
-    size_t len;
-} NetworkRxPacket;
-
 /**
  * @brief Mapira konfiguraciju klijenta koja se kasnije koristi za spajanje na mrežu i inicijalizira network
  * sustav klijenta.
@@ -74,4 +73,12 @@ AppNetworkStatus network_uninit(void);
  */
 void sent_via_network_statistics(uint32_t* reports, uint32_t* responses);
 
+/**
+ * @brief Traži od network taska da pošalje sve trenutne trace zapise serveru (PACKET_TRACE paketi).
+ * 
+ * Slanje se obavlja u network tasku čim je mreža spojena. Za vrijeme slanja bilježenje je isključeno,
+ * a nakon slanja ringovi se brišu.
+ */
+void network_request_trace_dump(void);
+
 bool network_poll_rx(uint8_t* out_buf, size_t buf_len, size_t* out_len, uint32_t timeout_in_ms);
\ No newline at end of file
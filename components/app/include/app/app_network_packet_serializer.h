@@ -8,7 +8,7 @@
  * 
  * Sve strukture sadrže __attribute__((packed)), što znači da nema kompajlerski dodanog paddinga između elemenata.
  * 
- * Struktura payloada serijaliziranog reporta sastoji se od 34 bajta ona je predstavljena na način:
+ * Struktura payloada serijaliziranog reporta (verzija paketa 0x01) sastoji se od 34 bajta ona je predstavljena na način:
  *  -prvih 6 bajtova -> samo onaj koji tip reporta dolazi će biti 0x01, ostali 0x00
  *  -bajt 7 -> informacija o uspješnosti inicijalizacije senzora
  *  -bajt 8 -> informacija o presence
@@ -17,6 +17,10 @@
  *  -bajt 14 -> informacija o proximity
  *  -bajtovi 15-34 -> informacije iz UOF reporta (4 bajta existence_energy, 4 bajta static_distance, 4 bajta motion_energy, 4 bajta motion_distance i 4 bajta motion_speed)
  * 
+ * Uz APP_UOF_NO_FLOAT=1 (build bez float polja) šalje se verzija paketa 0x02, a payload reporta ima 22 bajta - bajtovi 15-22
+ * nose UOF report kao cijele brojeve (1 bajt existence_energy, 1 bajt motion_energy, 2 bajta static_distance u cm,
+ * 2 bajta motion_distance u cm i 2 bajta motion_speed u cm/s). Ostali paketi su u obje verzije jednaki.
+ * 
  * Struktura payloada serijaliziranog responsea sastoji se od (3 + MAX_RESPONSE_DATA_LEN) bajta, te je predstavljena na način:
  *  -bajt 1 -> tip responsea
  *  -bajtovi 2-3 -> duljina podataka
@@ -31,6 +35,13 @@
  * 
  * Payload se spaja s headerom i to nam daje paket koji je pogodan za slanje mrežom.
  * 
+ * Trace paket (PACKET_TRACE) nosi dio binarnih trace zapisa platform sloja - payload je 1 bajt s brojem zapisa
+ * nakon kojeg slijede zapisi od po 12 bajtova (PlatformTraceRecord_t), pa mu je duljina promjenjiva.
+ * 
+ * Hello paket (PACKET_HELLO) šalje se jednom nakon spajanja na server i nosi podatke o uređaju iz cachea, pa ih
+ * server ne mora tražiti upitima. Payload se sastoji od 4 * APP_DEVICE_INFO_MAX_LEN bajta: product model, product ID,
+ * hardware model i firmware version, svaki kao string dopunjen nulama do APP_DEVICE_INFO_MAX_LEN bajta.
+ * 
  * @note Paketi su najjednostavnije verzije i nemaju mehanizme za zaštitu od grešaka.
  * 
  * @version 0.1
@@ -45,12 +56,24 @@
 #include <stdbool.h>
 #include "app/app_mmwave_constants.h"
 #include "app/app_types.h"
+#include "app/app_mmwave_device_info.h"
+#include "platform/platform_trace.h"
 
 /**
- * @brief Verzija paketa.
+ * @brief Verzija paketa (0x02 - UOF report kao cijeli brojevi, samo uz APP_UOF_NO_FLOAT=1).
  * 
  */
+#if APP_UOF_NO_FLOAT
+#define PACKET_VERSION 0x02
+#else
 #define PACKET_VERSION 0x01
+#endif
+
+/**
+ * @brief Najveći broj trace zapisa u jednom trace paketu (payload mora stati u 255 bajtova).
+ * 
+ */
+#define TRACE_PACKET_MAX_RECORDS 20
 
 /**
  * @enum PacketType_t
@@ -59,7 +82,9 @@
  */
 typedef enum {
     PACKET_REPORT,
-    PACKET_RESPONSE
+    PACKET_RESPONSE,
+    PACKET_TRACE,
+    PACKET_HELLO
 } PacketType_t;
 
 /**
@@ -93,11 +118,19 @@ typedef struct __attribute__((packed)) {
     int32_t bmp_info;
     uint8_t proximity_info; //ProximityInfo enum
     //uof_report:
+#if APP_UOF_NO_FLOAT
+    uint8_t existence_energy;
+    uint8_t motion_energy;
+    int16_t static_distance_cm;
+    int16_t motion_distance_cm;
+    int16_t motion_speed_cms;
+#else
     int32_t existence_energy;
     float static_distance;
     int32_t motion_energy;
     float motion_distance;
     float motion_speed;
+#endif
 } ReportPacketPayload_t;
 
 /**
@@ -131,6 +164,48 @@ typedef struct __attribute__((packed)) {
     ResponsePacketPayload_t response_payload;
 } ResponsePacket_t;
 
+/**
+ * @struct TracePacketPayload_t
+ * @brief Payload trace paketa.
+ * 
+ */
+typedef struct __attribute__((packed)) {
+    uint8_t record_count;
+    PlatformTraceRecord_t records[TRACE_PACKET_MAX_RECORDS];
+} TracePacketPayload_t;
+
+/**
+ * @struct TracePacket_t
+ * @brief Struktura čitavog trace paketa (šalje se samo header i stvarno popunjeni zapisi).
+ * 
+ */
+typedef struct __attribute__((packed)) {
+    PacketHeader_t header;
+    TracePacketPayload_t trace_payload;
+} TracePacket_t;
+
+/**
+ * @struct HelloPacketPayload_t
+ * @brief Payload hello paketa.
+ * 
+ */
+typedef struct __attribute__((packed)) {
+    char product_model[APP_DEVICE_INFO_MAX_LEN];
+    char product_id[APP_DEVICE_INFO_MAX_LEN];
+    char hardware_model[APP_DEVICE_INFO_MAX_LEN];
+    char firmware_version[APP_DEVICE_INFO_MAX_LEN];
+} HelloPacketPayload_t;
+
+/**
+ * @struct HelloPacket_t
+ * @brief Struktura čitavog hello paketa.
+ * 
+ */
+typedef struct __attribute__((packed)) {
+    PacketHeader_t header;
+    HelloPacketPayload_t hello_payload;
+} HelloPacket_t;
+
 /**
  * @brief Serijalizira report.
  * 
@@ -149,4 +224,25 @@ int app_serialize_report(DecodedReport* report, uint8_t* packet, size_t packet_l
  * @param packet_len Duljina buffera za spremanje paketa
  * @return Veličina izrađenog paketa ili -1 kod neuspjeha
  */
-int app_serialize_response(DecodedResponse* response, uint8_t* packet, size_t packet_len);
\ No newline at end of file
+int app_serialize_response(DecodedResponse* response, uint8_t* packet, size_t packet_len);
+
+/**
+ * @brief Serijalizira dio trace zapisa u trace paket.
+ * 
+ * @param records Pokazivač na polje trace zapisa
+ * @param count Broj zapisa (najviše TRACE_PACKET_MAX_RECORDS)
+ * @param packet Pokazivač na packet u kojemu će biti serijalizirani zapisi
+ * @param packet_len Duljina buffera za spremanje paketa
+ * @return Veličina izrađenog paketa ili -1 kod neuspjeha
+ */
+int app_serialize_trace(const PlatformTraceRecord_t* records, size_t count, uint8_t* packet, size_t packet_len);
+
+/**
+ * @brief Serijalizira podatke o uređaju u hello paket.
+ * 
+ * @param info Pokazivač na podatke o uređaju
+ * @param packet Pokazivač na packet u kojemu će biti serijalizirani podatci
+ * @param packet_len Duljina buffera za spremanje paketa
+ * @return Veličina izrađenog paketa ili -1 kod neuspjeha
+ */
+int app_serialize_hello(const MmwaveDeviceInfo* info, uint8_t* packet, size_t packet_len);
\ No newline at end of file
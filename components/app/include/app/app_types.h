@@ -22,10 +22,11 @@
 #include "app/app_mmwave_constants.h"
 
 /**
- * @brief Veličina queue-a za evente aplikacijskog sloja.
+ * @brief Kapacitet ringova za evente aplikacijskog sloja (broj eventova po vrijednosti).
  * 
+ * @note Mora biti potencija broja 2 (zahtjev lock-free ringa).
  */
-#define APP_EVENT_QUEUE_LEN 200
+#define APP_EVENT_QUEUE_LEN 256
 
 /**
  * @brief Maksimalna dopuštena duljina response payloada (u bajtovima).
@@ -44,7 +45,8 @@ typedef enum {
     APP_SENSOR_INVALID_STATE, /**< Modul se nalazi u pogrešnom stanju */
     APP_SENSOR_BUSY, /**< Sustav zauzet */
     APP_SENSOR_BAD_ARGUMENT, /**< Neispravan argument funkcije */
-    APP_SENSOR_BAD_MODE /**< Neispravan mode */
+    APP_SENSOR_BAD_MODE, /**< Neispravan mode */
+    APP_SENSOR_TIMEOUT /**< Odgovor nije stigao u zadanom vremenu */
 } AppSensorStatus;
 
 /**
@@ -148,6 +150,18 @@ typedef enum {
     MMWAVE_EVENT_RESPONSE /**< Response tip eventa */
 } MmwaveEventType;
 
+/**
+ * @brief Izbacuje float polja iz uof_report strukture (1 - samo cjelobrojne vrijednosti u cm i cm/s).
+ * 
+ * Udaljenosti i brzina UOF reporta uvijek su dostupne kao cijeli brojevi (koraci od 50 cm i 50 cm/s), a float
+ * polja u metrima i m/s postoje samo radi kompatibilnosti i računaju se iz njih.
+ * 
+ * @note Određuje i format report paketa: po defaultu verzija 0x01 (float), a uz 1 verzija 0x02 (cijeli brojevi).
+ */
+#ifndef APP_UOF_NO_FLOAT
+#define APP_UOF_NO_FLOAT 0
+#endif
+
 /**
  * @struct uof_report
  * @brief Underlying Open Function (UOF) report.
@@ -156,10 +170,15 @@ typedef enum {
 typedef struct
 {
     int existence_energy; /**< Existence energy */
-    float static_distance; /**< Static distance */
     int motion_energy; /**< Motion energy */
-    float motion_distance; /**< Motion distance */
-    float motion_speed; /**< Motion speed */
+    int16_t static_distance_cm; /**< Static distance u cm */
+    int16_t motion_distance_cm; /**< Motion distance u cm */
+    int16_t motion_speed_cms; /**< Motion speed u cm/s (negativna - udaljavanje) */
+#if !APP_UOF_NO_FLOAT
+    float static_distance; /**< Static distance u m */
+    float motion_distance; /**< Motion distance u m */
+    float motion_speed; /**< Motion speed u m/s */
+#endif
 } uof_report;
 
 /**
@@ -188,6 +207,44 @@ typedef struct {
     uof_report uof_rep; /**< UOF report podatak */
 } DecodedReport;
 
+/**
+ * @enum ReportKind
+ * @brief Vrsta podatka koju nosi kompaktni report.
+ * 
+ */
+typedef enum {
+    REPORT_KIND_NONE = 0, /**< Report bez podatka */
+    REPORT_KIND_INIT_COMPLETED, /**< Init completed info */
+    REPORT_KIND_PRESENCE, /**< Presence info */
+    REPORT_KIND_MOTION, /**< Motion info */
+    REPORT_KIND_BMP, /**< BodyMotionParameter (BMP) info */
+    REPORT_KIND_PROXIMITY, /**< Proximity info */
+    REPORT_KIND_UOF /**< UOF report */
+} ReportKind;
+
+/**
+ * @struct CompactReport
+ * @brief Kompaktni report za interni put podataka (decoder -> manager -> ring).
+ * 
+ * Svaki report nosi točno jednu vrstu podatka, pa se umjesto svih zastavica i polja DecodedReport
+ * strukture prenosi samo vrsta i sirove vrijednosti iz frame-a (6 bajtova umjesto ~48). UOF kodovi
+ * udaljenosti i brzine ostaju nepretvoreni - u DecodedReport ih pretvara app_mmwave_decoder_expand_report().
+ * 
+ */
+typedef struct {
+    uint8_t kind; /**< Vrsta podatka (ReportKind) */
+    union {
+        uint8_t value; /**< Vrijednost za init completed, presence, motion, BMP i proximity */
+        struct {
+            uint8_t existence_energy; /**< Existence energy */
+            uint8_t static_distance; /**< Kod static distance */
+            uint8_t motion_energy; /**< Motion energy */
+            uint8_t motion_distance; /**< Kod motion distance */
+            uint8_t motion_speed; /**< Kod motion speed */
+        } uof; /**< Sirovi UOF report */
+    };
+} CompactReport;
+
 /**
  * @struct DecodedResponse
  * @brief Dekodirani odgovor na prethodni upit.
@@ -199,10 +256,24 @@ typedef struct {
  */
 typedef struct {
     AppInquiryType type; /**< Tip odgovora */
+    uint8_t ctrl_w; /**< Control word odgovora (jednak onom iz upita) */
+    uint8_t cmd_w; /**< Command word odgovora (jednak onom iz upita) */
     uint8_t data[MAX_RESPONSE_DATA_LEN]; /**< Polje s podatke odgovora */
     size_t data_l; /**< Duljina podataka odgovora */
 } DecodedResponse;
 
+/**
+ * @struct AppRequestTicket
+ * @brief Upit predan tablici upita koji čekaju odgovor.
+ * 
+ * Pozivatelji koji se pridruže istom upitu dijele mjesto u tablici, ali svaki čeka do svojeg roka.
+ * 
+ */
+typedef struct {
+    int id; /**< Indeks mjesta u tablici upita */
+    uint32_t deadline_ms; /**< Rok pozivatelja do kojeg se čeka odgovor */
+} AppRequestTicket;
+
 /**
  * @typedef MMwaveReportCallback
  * @brief Callback funkcija za notifikacije vanjskog programa o novim report-ovima.
@@ -217,4 +288,77 @@ typedef void (*MMwaveReportCallback)(DecodedReport report);
  * 
  * @param event mmWave response struktura
  */
-typedef void (*MMwaveResponseCallback)(DecodedResponse response);
\ No newline at end of file
+typedef void (*MMwaveResponseCallback)(DecodedResponse response);
+
+/**
+ * @brief Bit maske pretplate za report određene vrste (ReportKind).
+ * 
+ */
+#define MMWAVE_EVENT_MASK_REPORT(kind) (1u << (kind))
+
+/**
+ * @brief Bit maske pretplate za sve response-ove.
+ * 
+ */
+#define MMWAVE_EVENT_MASK_RESPONSE (1u << 7)
+
+/**
+ * @brief Maska pretplate za sve vrste reporta.
+ * 
+ */
+#define MMWAVE_EVENT_MASK_ALL_REPORTS \
+    (MMWAVE_EVENT_MASK_REPORT(REPORT_KIND_UOF + 1) - MMWAVE_EVENT_MASK_REPORT(REPORT_KIND_INIT_COMPLETED))
+
+/**
+ * @brief Maska pretplate za sve reporte i response-ove.
+ * 
+ */
+#define MMWAVE_EVENT_MASK_ALL (MMWAVE_EVENT_MASK_ALL_REPORTS | MMWAVE_EVENT_MASK_RESPONSE)
+
+/**
+ * @typedef MMwaveReportCallbackV2
+ * @brief Callback funkcija pretplatnika za nove report-ove (v2).
+ * 
+ * Report se predaje preko pokazivača i vrijedi samo za vrijeme poziva - pretplatnik ga kopira ako ga treba kasnije.
+ * 
+ * @param report Pokazivač na mmWave report strukturu
+ * @param user Kontekst pretplatnika zadan kod pretplate
+ */
+typedef void (*MMwaveReportCallbackV2)(const DecodedReport* report, void* user);
+
+/**
+ * @typedef MMwaveResponseCallbackV2
+ * @brief Callback funkcija pretplatnika za nove response-ove (v2).
+ * 
+ * Response se predaje preko pokazivača i vrijedi samo za vrijeme poziva - pretplatnik ga kopira ako ga treba kasnije.
+ * 
+ * @param response Pokazivač na mmWave response strukturu
+ * @param user Kontekst pretplatnika zadan kod pretplate
+ */
+typedef void (*MMwaveResponseCallbackV2)(const DecodedResponse* response, void* user);
+
+/**
+ * @struct MmwaveSubscription
+ * @brief Pretplata vanjskog programa na eventove senzora (v2 callback API).
+ * 
+ * Pretplatnik se poziva samo za eventove čiji je bit postavljen u event_mask. Callback koji nije
+ * potreban smije biti NULL.
+ * 
+ */
+typedef struct {
+    MMwaveReportCallbackV2 on_report; /**< Callback za reporte (ili NULL) */
+    MMwaveResponseCallbackV2 on_response; /**< Callback za response-ove (ili NULL) */
+    void* user; /**< Kontekst koji se predaje callbackovima */
+    uint32_t event_mask; /**< Maska eventova (MMWAVE_EVENT_MASK_*) */
+} MmwaveSubscription;
+
+/**
+ * @typedef MmwaveReadyCallback
+ * @brief Callback funkcija koja se poziva kada senzor postane spreman za rad.
+ * 
+ * Poziva se iz decoder taska, jednom po prelasku u stanje spremnosti (Initialization Completed report
+ * ili odgovor na Initialization Status upit), pa i nakon svakog ponovnog pokretanja senzora.
+ * 
+ * @param user Kontekst zadan kod registracije
+ */
+typedef void (*MmwaveReadyCallback)(void* user);
\ No newline at end of file
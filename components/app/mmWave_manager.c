@@ -24,68 +24,165 @@
 #include "my_hal/hal_mmwave.h"
 #include "app/app_mmwave_hal_config.h"
 #include "my_hal/system_monitor.h"
+#include "app/app_event_ring.h"
+#include "app/app_mmwave_state.h"
+#include "app/app_mmwave_request.h"
+#include "app/app_mmwave_config.h"
+#include "app/app_mmwave_scheduler.h"
+#include "app/app_mmwave_device_info.h"
 
 static AppSensorState current_state = APP_SENSOR_UNINIT;
-static PlatformQueueHandle app_report_queue; //event queue za Report
-static PlatformQueueHandle app_response_queue; //event queue za Response
+static AppEventRing_t app_report_ring; //ring za Report evente (kompaktni oblik, po vrijednosti)
+static AppEventRing_t app_response_ring; //ring za Response evente (po vrijednosti)
 static SensorOperationMode current_mode = SENSOR_MODE_STANDARD; //mode senzora
 static task_handler decoder_task_handler;
 static MMwaveReportCallback higher_app_report_callback;
 static MMwaveResponseCallback higher_app_response_callback;
-static volatile bool end_flag = false;
-static volatile bool task_ended = false;
-static MutexHandle_t report_queue_mutex;
-static MutexHandle_t response_queue_mutex;
+static MmwaveReadyCallback ready_callback;
+static void* ready_callback_user;
+static MmwaveSubscription subscribers[APP_MAX_SUBSCRIBERS]; //pretplatnici v2 API-ja, slobodno mjesto ima event_mask 0
+static uint32_t subscribed_events; //unija maski svih pretplatnika - decoder task bez locka preskače evente bez pretplatnika
+static MutexHandle_t subscribers_mutex = NULL; //štiti tablicu pretplatnika
+static PlatformSignalHandle decoder_signal = NULL; //signali za zaustavljanje i završetak decoder taska
+
+#define DECODER_TASK_STACK_SIZE 16000 //veličina stacka decoder taska u bajtovima
+#define DECODER_WAIT_MS 100 //najdulje čekanje decoder taska na frame prije ponovne provjere zaustavljanja
+
+#define DECODER_SIGNAL_STOP (1 << 0) //manager traži zaustavljanje decoder taska
+#define DECODER_SIGNAL_ENDED (1 << 1) //decoder task je završio s radom
+#define DECODER_SIGNAL_READY (1 << 2) //senzor je spreman za rad (postavlja samo decoder task)
+
+#define REPORT_EXPAND_BATCH 16 //broj kompaktnih reporta koje app_get_reports odjednom uzima iz ringa i pretvara
+
+//Statička memorija za decoder task i ringove eventova - ponovljeni init/start ne fragmentira heap, a eventovi se ne alociraju
+static uint8_t decoder_task_stack[DECODER_TASK_STACK_SIZE];
+static PlatformStaticTask_t decoder_task_buffer;
+static CompactReport report_ring_storage[APP_EVENT_QUEUE_LEN];
+static uint32_t report_ring_seq[APP_EVENT_QUEUE_LEN];
+static DecodedResponse response_ring_storage[APP_EVENT_QUEUE_LEN];
+static uint32_t response_ring_seq[APP_EVENT_QUEUE_LEN];
+static PlatformStaticSignal_t decoder_signal_buffer;
+static PlatformStaticMutex_t subscribers_mutex_buffer;
+
+static PlatformTimingStats_t decode_timing; //statistika trajanja dekodiranja jednog frame-a (ažurira samo decoder task)
 
 static AppDecoderContext decoder_ctx = {
         .sendReportCallback = onReport,
         .sendResponseCallback = onResponse
 };
 
+/**
+ * @brief Kopira pretplatnike zainteresirane za event.
+ * 
+ * Lock se drži samo za kopiranje tablice, pa callbackovi pretplatnika rade izvan locka i smiju mijenjati pretplate.
+ * 
+ * @param event_bit Bit eventa (MMWAVE_EVENT_MASK_*)
+ * @param out Polje za barem APP_MAX_SUBSCRIBERS pretplata
+ * @return Broj kopiranih pretplata
+ */
+static size_t subscribers_snapshot(uint32_t event_bit, MmwaveSubscription* out)
+{
+    if(!(__atomic_load_n(&subscribed_events, __ATOMIC_RELAXED) & event_bit)) {
+        return 0;
+    }
+    if(platform_lock_mutex(subscribers_mutex, MUTEX_WAIT_FOREVER) != MUTEX_OP_SUCCESSFUL) {
+        return 0;
+    }
+    size_t n = 0;
+    for(size_t i = 0; i < APP_MAX_SUBSCRIBERS; i++) {
+        if(subscribers[i].event_mask & event_bit) {
+            out[n++] = subscribers[i];
+        }
+    }
+    platform_unlock_mutex(subscribers_mutex);
+    return n;
+}
+
+/**
+ * @brief Ponovno računa uniju maski svih pretplatnika.
+ * 
+ * @note Poziva se s zauzetim subscribers_mutex.
+ * 
+ */
+static void subscribers_update_events(void)
+{
+    uint32_t events = 0;
+    for(size_t i = 0; i < APP_MAX_SUBSCRIBERS; i++) {
+        events |= subscribers[i].event_mask;
+    }
+    __atomic_store_n(&subscribed_events, events, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief Mijenja stanje spremnosti senzora i kod prelaska u spremno stanje poziva ready callback.
+ * 
+ * Poziva se samo iz decoder taska, pa provjera prethodnog stanja i promjena ne trebaju lock.
+ * 
+ * @param ready Novo stanje spremnosti
+ */
+static void ready_update(bool ready)
+{
+    bool was_ready = (platform_signal_get(decoder_signal) & DECODER_SIGNAL_READY) != 0;
+    if(!ready) {
+        platform_signal_clear(decoder_signal, DECODER_SIGNAL_READY);
+        return;
+    }
+    platform_signal_set(decoder_signal, DECODER_SIGNAL_READY);
+    if(was_ready) {
+        return;
+    }
+    //podatci o uređaju čitaju se jednom, čim senzor postane spreman (odgovori pune cache)
+    app_device_info_request_missing();
+    if(ready_callback) {
+        ready_callback(ready_callback_user);
+    }
+}
+
 /**
  * @brief Task za obradu (dekodiranje) primljenih parsiranih podataka.
  * 
- *  Uzima podatke iz HAL queue-a, preuzima ownership frame-a na aplikacijski sloj, dekodira podatke, te
- *  nakon slanja reporta/requesta oslobađa memoriju koju je frame bio zauzimao.
+ *  Posuđuje frame iz HAL queue-a (bez kopiranja), dekodira podatke direktno iz HAL-ove memorije, te
+ *  nakon slanja reporta/requesta vraća frame HAL-u koji oslobađa memoriju.
  * 
- * Task će se sam ugasiti i osloboditi zauzete resurse kada dobije flag od managera.
+ * Task će se sam ugasiti i osloboditi zauzete resurse kada dobije signal DECODER_SIGNAL_STOP od managera,
+ * a završetak javlja signalom DECODER_SIGNAL_ENDED (nakon toga blokira dok ga app_stop_sys() ne obriše).
  * 
  * @param arg Ne koristi se
  */
 static void decoder_task(void* arg)
 {
-    FrameData_t buffer;
+    HalFrameView_t frame;
     for(;;) {
-        if(hal_mmwave_get_frame_from_queue(&buffer, 20) != HAL_MMWAVE_OK) {
-            if(end_flag) {
+        //raspoređeni upiti šalju se iz ovog taska, pa čekanje na frame ne smije trajati dulje od sljedećeg dospijeća
+        uint32_t schedule_ms = app_scheduler_run(platform_getNumOfMs());
+        HalMmwaveStatus hs = hal_mmwave_borrow_frame(&frame, (schedule_ms < DECODER_WAIT_MS) ? schedule_ms : DECODER_WAIT_MS);
+        if(hs != HAL_MMWAVE_OK) {
+            if(platform_signal_get(decoder_signal) & DECODER_SIGNAL_STOP) {
                 system_monitor_unregister_task(decoder_task_handler);
-                task_ended = true;
-                decoder_task_handler = NULL;
-                platform_delete_task(NULL);
+                platform_signal_set(decoder_signal, DECODER_SIGNAL_ENDED);
+                platform_park_task(); //task briše app_stop_sys()
+            }
+            if(hs == HAL_MMWAVE_INVALID_STATE) {
+                //HAL ne radi pa se get vraća odmah - blokiramo na signalu umjesto vrtnje
+                platform_signal_wait(decoder_signal, DECODER_SIGNAL_STOP, true, false, DECODER_WAIT_MS);
             }
-            platform_delay_task(20);
             continue;
         }
-        if(buffer.data == NULL || buffer.len == 0) {
-            hal_mmwave_release_frame_memory(&buffer);
+        if(frame.data == NULL || frame.len == 0) {
+            hal_mmwave_return_frame(&frame);
             continue;
         }
 
-        uint8_t* frameCopy;
-        size_t copy_len = buffer.len;
-        if(platform_malloc((void**)&frameCopy, buffer.len) != MEM_OK) {
-            printf("[decoder_task] ERROR: cannot allocate memory for deep copy\n");
-            hal_mmwave_release_frame_memory(&buffer);
-            continue;
-        }
-        memcpy(frameCopy, buffer.data, buffer.len); //samo podatci se kopiraju u frameCopy
+        //dekodiramo direktno frame posuđen od HAL-a (bez kopije), a vraćamo ga tek nakon dekodiranja
+        uint16_t trace_id = (frame.len >= 2) ? (uint16_t)((frame.data[0] << 8) | frame.data[1]) : 0;
+        PLATFORM_TRACE(PLATFORM_TRACE_DECODE_BEGIN, trace_id);
+        PLATFORM_TIMING_BEGIN(decode);
+        app_mmwave_decoder_process_frame(frame.data, frame.len);
+        PLATFORM_TIMING_END(decode, &decode_timing);
+        PLATFORM_TRACE(PLATFORM_TRACE_DECODE_END, trace_id);
 
         //oslobađamo memoriju koju je mmwave_core zauzeo za spremanje frame-a
-        hal_mmwave_release_frame_memory(&buffer);
-        
-        app_mmwave_decoder_process_frame(frameCopy, copy_len);
-
-        platform_free(frameCopy);
+        hal_mmwave_return_frame(&frame);
     }
 }
 
@@ -110,23 +207,45 @@ AppSensorStatus app_init_sys(void)
     }
 
     app_mmwave_decoder_init(&decoder_ctx);
+    app_mmwave_state_reset();
+
+    if(!app_event_ring_init(&app_report_ring, report_ring_storage, report_ring_seq, sizeof(CompactReport),
+            APP_EVENT_QUEUE_LEN) ||
+        !app_event_ring_init(&app_response_ring, response_ring_storage, response_ring_seq, sizeof(DecodedResponse),
+            APP_EVENT_QUEUE_LEN)) {
+        printf("[APP INIT] Response & Report ring nisu uspjesno izradeni\n");
+        return APP_SENSOR_ERROR;
+    }
+
+    decoder_signal = platform_signal_create_static(&decoder_signal_buffer);
+    if(!decoder_signal) {
+        printf("[APP INIT] Signal nije uspješno izrađen\n");
+        return APP_SENSOR_ERROR;
+    }
+
+    memset(subscribers, 0, sizeof(subscribers));
+    subscribers_update_events();
+    subscribers_mutex = platform_create_mutex_static(&subscribers_mutex_buffer);
+    if(!subscribers_mutex) {
+        printf("[APP INIT] Mutex pretplatnika nije uspješno izrađen\n");
+        return APP_SENSOR_ERROR;
+    }
 
-    app_report_queue = platform_queue_create(APP_EVENT_QUEUE_LEN, sizeof(DecodedReport*));
-    app_response_queue = platform_queue_create(APP_EVENT_QUEUE_LEN, sizeof(DecodedResponse*));
-    if(!app_report_queue || !app_response_queue) {
-        printf("[APP INIT] Response & Report queue nisu uspjesno izradeni\n");
+    if(!app_request_init()) {
+        printf("[APP INIT] Tablica upita nije uspješno izrađena\n");
         return APP_SENSOR_ERROR;
     }
 
-    report_queue_mutex = platform_create_mutex();
-    response_queue_mutex = platform_create_mutex();
-    if(!report_queue_mutex || !response_queue_mutex) {
-        printf("[APP INIT] Mutex nije uspješno izrađen\n");
+    if(!app_scheduler_init()) {
+        printf("[APP INIT] Raspored upita nije uspješno izrađen\n");
+        return APP_SENSOR_ERROR;
+    }
+
+    if(!app_device_info_init()) {
+        printf("[APP INIT] Cache podataka o uređaju nije uspješno izrađen\n");
         return APP_SENSOR_ERROR;
     }
 
-    end_flag = false;
-    task_ended = false;
     current_state = APP_SENSOR_INIT;
     return APP_SENSOR_OK;
 }
@@ -141,8 +260,12 @@ AppSensorStatus app_start_sys(void)
         return APP_SENSOR_ERROR;
     }
 
-    TaskConfig_t task_conf = {decoder_task, "decoder_task", 16000, NULL, 6};
-    decoder_task_handler = platform_create_task(&task_conf);
+    //spremnost se ponovno utvrđuje nakon svakog pokretanja (senzor se mogao resetirati dok sustav nije radio)
+    platform_signal_clear(decoder_signal, DECODER_SIGNAL_STOP | DECODER_SIGNAL_ENDED | DECODER_SIGNAL_READY);
+    platform_timing_reset(&decode_timing);
+    TaskConfig_t task_conf = {decoder_task, "decoder_task", DECODER_TASK_STACK_SIZE, NULL, 6,
+        PLATFORM_TASK_CORE_SENSOR};
+    decoder_task_handler = platform_create_task_static(&task_conf, decoder_task_stack, &decoder_task_buffer);
     if(!decoder_task_handler) {
         printf("[app_start] ERROR: decoder task not created\n");
         return APP_SENSOR_ERROR;
@@ -163,21 +286,10 @@ AppSensorStatus app_stop_sys(void)
         return APP_SENSOR_ERROR;
     }
 
-    end_flag = true;
-    while(!task_ended) {
-        platform_delay_task(10);
-    }
-
-    platform_delete_mutex(report_queue_mutex);
-    platform_delete_mutex(response_queue_mutex);
-    report_queue_mutex = NULL;
-    response_queue_mutex = NULL;
-
-    platform_queue_delete(app_report_queue);
-    app_report_queue = NULL;
-
-    platform_queue_delete(app_response_queue);
-    app_response_queue = NULL;
+    platform_signal_set(decoder_signal, DECODER_SIGNAL_STOP);
+    platform_signal_wait(decoder_signal, DECODER_SIGNAL_ENDED, true, false, PLATFORM_SIGNAL_WAIT_FOREVER);
+    platform_delete_task(decoder_task_handler);
+    decoder_task_handler = NULL;
 
     current_state = APP_SENSOR_STOPPED;
     return APP_SENSOR_OK;
@@ -194,8 +306,21 @@ AppSensorStatus app_deinit_sys(void)
     }
     app_mmwave_decoder_deinit();
 
-    end_flag = false;
-    task_ended = false;
+    //ringovi žive od init do deinit - ponovljeni stop/start ih ne smije ostaviti obrisanima
+    app_event_ring_deinit(&app_report_ring);
+    app_event_ring_deinit(&app_response_ring);
+
+    platform_signal_delete(decoder_signal);
+    decoder_signal = NULL;
+
+    //decoder task je zaustavljen pa pretplatnike nitko ne čita
+    memset(subscribers, 0, sizeof(subscribers));
+    subscribers_update_events();
+    platform_delete_mutex(subscribers_mutex);
+    subscribers_mutex = NULL;
+    app_request_deinit();
+    app_scheduler_deinit();
+    app_device_info_deinit();
 
     current_state = APP_SENSOR_UNINIT;
     return APP_SENSOR_OK;
@@ -224,93 +349,224 @@ void mmwave_register_event_callback(MMwaveResponseCallback res_cb, MMwaveReportC
     higher_app_report_callback = rep_cb;
 }
 
+void app_register_ready_callback(MmwaveReadyCallback cb, void* user)
+{
+    ready_callback = cb;
+    ready_callback_user = user;
+}
+
+bool app_is_ready(void)
+{
+    if(current_state != APP_SENSOR_RUNNING) {
+        return false;
+    }
+    return (platform_signal_get(decoder_signal) & DECODER_SIGNAL_READY) != 0;
+}
+
+AppSensorStatus app_wait_ready(uint32_t timeout_ms)
+{
+    if(current_state != APP_SENSOR_RUNNING) {
+        return APP_SENSOR_INVALID_STATE;
+    }
+    uint32_t start = platform_getNumOfMs();
+    const uint8_t data = INIT_STATUS_I_DATA;
+    for(;;) {
+        if(platform_signal_get(decoder_signal) & DECODER_SIGNAL_READY) {
+            return APP_SENSOR_OK;
+        }
+        uint32_t elapsed = platform_getNumOfMs() - start;
+        if(elapsed >= timeout_ms) {
+            return APP_SENSOR_TIMEOUT;
+        }
+        uint32_t probe_ms = (timeout_ms - elapsed < APP_READY_PROBE_MS) ? (timeout_ms - elapsed) : APP_READY_PROBE_MS;
+
+        //odgovor na upit postavlja spremnost u decoder tasku, a report se čeka na signalu do sljedećeg upita
+        uint32_t probe_start = platform_getNumOfMs();
+        AppRequestTicket request;
+        if(app_request_submit(&data, INIT_STATUS_I_LEN, INIT_STATUS_I_CTRL, INIT_STATUS_I_CMD, probe_ms, &request) ==
+            APP_SENSOR_OK) {
+            app_request_wait(&request, NULL);
+        }
+        uint32_t probe_elapsed = platform_getNumOfMs() - probe_start;
+        if(probe_elapsed < probe_ms) {
+            platform_signal_wait(decoder_signal, DECODER_SIGNAL_READY, true, false, probe_ms - probe_elapsed);
+        }
+    }
+}
+
+AppSensorStatus app_subscribe(const MmwaveSubscription* sub, int* out_id)
+{
+    if(!sub || !out_id) {
+        return APP_SENSOR_BAD_ARGUMENT;
+    }
+    //bitovi za koje pretplatnik nema callback se odbacuju
+    uint32_t mask = sub->event_mask & MMWAVE_EVENT_MASK_ALL;
+    if(!sub->on_report) {
+        mask &= ~MMWAVE_EVENT_MASK_ALL_REPORTS;
+    }
+    if(!sub->on_response) {
+        mask &= ~MMWAVE_EVENT_MASK_RESPONSE;
+    }
+    if(mask == 0) {
+        return APP_SENSOR_BAD_ARGUMENT;
+    }
+    if(current_state == APP_SENSOR_UNINIT) {
+        return APP_SENSOR_INVALID_STATE;
+    }
+
+    if(platform_lock_mutex(subscribers_mutex, MUTEX_WAIT_FOREVER) != MUTEX_OP_SUCCESSFUL) {
+        return APP_SENSOR_ERROR;
+    }
+    AppSensorStatus status = APP_SENSOR_BUSY;
+    for(int i = 0; i < APP_MAX_SUBSCRIBERS; i++) {
+        if(subscribers[i].event_mask == 0) {
+            subscribers[i] = *sub;
+            subscribers[i].event_mask = mask;
+            subscribers_update_events();
+            *out_id = i;
+            status = APP_SENSOR_OK;
+            break;
+        }
+    }
+    platform_unlock_mutex(subscribers_mutex);
+    return status;
+}
+
+AppSensorStatus app_unsubscribe(int id)
+{
+    if(id < 0 || id >= APP_MAX_SUBSCRIBERS) {
+        return APP_SENSOR_BAD_ARGUMENT;
+    }
+    if(current_state == APP_SENSOR_UNINIT) {
+        return APP_SENSOR_INVALID_STATE;
+    }
+
+    if(platform_lock_mutex(subscribers_mutex, MUTEX_WAIT_FOREVER) != MUTEX_OP_SUCCESSFUL) {
+        return APP_SENSOR_ERROR;
+    }
+    memset(&subscribers[id], 0, sizeof(subscribers[id]));
+    subscribers_update_events();
+    platform_unlock_mutex(subscribers_mutex);
+    return APP_SENSOR_OK;
+}
+
 bool app_get_response(DecodedResponse* out_response, uint32_t timeout_ms)
 {
-    DecodedResponse* buff;
-    bool result = false;
-    platform_lock_mutex(response_queue_mutex, UINT32_MAX);
-    if(platform_queue_get(app_response_queue, (QueueElement_t*)&buff, timeout_ms) == QUEUE_OK) {
-        *out_response = *buff;
-        platform_free(buff); //oslobađamo dinamički alociran pokazivač na DecodedResponse
-        result = true;
-    }
-    platform_unlock_mutex(response_queue_mutex);
-    return result;
+    return app_event_ring_pop(&app_response_ring, out_response, timeout_ms);
 }
 
 bool app_get_report(DecodedReport* out_report, uint32_t timeout_ms)
 {
-    DecodedReport* buff;
-    bool result = false;
-    platform_lock_mutex(report_queue_mutex, UINT32_MAX);
-    if(platform_queue_get(app_report_queue, (QueueElement_t*)&buff, timeout_ms) == QUEUE_OK) {
-        *out_report = *buff;
-        platform_free(buff); //oslobađamo dinamički alociran pokazivač na DecodedReport
-        result = true;
-    }
-    platform_unlock_mutex(report_queue_mutex);
-    return result;
+    CompactReport report;
+    if(!out_report || !app_event_ring_pop(&app_report_ring, &report, timeout_ms)) {
+        return false;
+    }
+    app_mmwave_decoder_expand_report(&report, out_report);
+    return true;
+}
+
+size_t app_get_responses(DecodedResponse* out_responses, size_t max, uint32_t timeout_ms)
+{
+    return app_event_ring_pop_batch(&app_response_ring, out_responses, max, timeout_ms);
 }
 
-void onResponse(DecodedResponse response)
+size_t app_get_reports(DecodedReport* out_reports, size_t max, uint32_t timeout_ms)
+{
+    if(!out_reports) {
+        return 0;
+    }
+    //ring se prazni u dijelovima veličine REPORT_EXPAND_BATCH dok se ne dohvati max reporta ili ring ne ostane prazan,
+    //a na report se čeka samo kod prvog dijela
+    CompactReport batch[REPORT_EXPAND_BATCH];
+    size_t total = 0;
+    while(total < max) {
+        size_t want = (max - total < REPORT_EXPAND_BATCH) ? (max - total) : REPORT_EXPAND_BATCH;
+        size_t n = app_event_ring_pop_batch(&app_report_ring, batch, want, (total == 0) ? timeout_ms : 0);
+        for(size_t i = 0; i < n; i++) {
+            app_mmwave_decoder_expand_report(&batch[i], &out_reports[total + i]);
+        }
+        total += n;
+        if(n < want) {
+            break;
+        }
+    }
+    return total;
+}
+
+size_t app_get_compact_reports(CompactReport* out_reports, size_t max, uint32_t timeout_ms)
+{
+    return app_event_ring_pop_batch(&app_report_ring, out_reports, max, timeout_ms);
+}
+
+void onResponse(const DecodedResponse* response)
 {
     // Provjera veličine response podataka - odbijamo ako prelazi maximum
-    if(response.data_l > MAX_RESPONSE_DATA_LEN) {
+    if(response->data_l > MAX_RESPONSE_DATA_LEN) {
         return;
     }
 
-    DecodedResponse* buff;
-    if (platform_malloc((void**)&buff, sizeof(DecodedResponse)) != MEM_OK) {
-        printf("[onResponse] ERROR: malloc failed\n");
-        return;
+    //ring je pun -> najstariji response je prepisan
+    if(!app_event_ring_push(&app_response_ring, response)) {
+        printf("[onResponse] WARNING: Ring full, oldest overwritten!\n");
     }
-    *buff = response;
-
-    platform_lock_mutex(response_queue_mutex, UINT32_MAX);
-    if(platform_queue_send(app_response_queue, (QueueElement_t*)&buff, 0) != QUEUE_OK) {
-        //Queue pun -> mičemo najstariji response
-        printf("[onResponse] WARNING: Queue full, removing oldest!\n");
-        DecodedResponse* garbage;
-        platform_queue_get(app_response_queue, (QueueElement_t*)&garbage, 0);
-        platform_free(garbage);
-        if(platform_queue_send(app_response_queue, (QueueElement_t*)&buff, 0) != QUEUE_OK) {
-            printf("[onResponse] ERROR: queue_send failed\n");
-            platform_free(buff);
-        }
+    PLATFORM_TRACE(PLATFORM_TRACE_QUEUE_SEND, sizeof(DecodedResponse));
+
+    //senzor koji odgovara na Initialization Status upit javlja i je li inicijalizacija završena,
+    //a nakon resetiranja nije spreman dok ponovno ne pošalje Initialization Completed
+    if(response->type == INIT_STATUS && response->data_l >= 1) {
+        ready_update(response->data[0] == INIT_STATUS_COMPLETED);
+    } else if(response->type == MODULE_RESET) {
+        ready_update(false);
     }
-    platform_unlock_mutex(response_queue_mutex);
+
+    //cache postavki se ažurira prije buđenja pozivatelja, pa on nakon odgovora vidi novu vrijednost
+    app_config_on_response(response);
+    app_scheduler_on_response(response);
+    app_device_info_on_response(response);
+
+    //budi pozivatelja koji čeka ovaj odgovor (response i dalje ide u ring i callbackove)
+    app_request_on_response(response);
 
     if(higher_app_response_callback) {
-        higher_app_response_callback(response);
+        higher_app_response_callback(*response);
+    }
+
+    MmwaveSubscription subs[APP_MAX_SUBSCRIBERS];
+    size_t n = subscribers_snapshot(MMWAVE_EVENT_MASK_RESPONSE, subs);
+    for(size_t i = 0; i < n; i++) {
+        subs[i].on_response(response, subs[i].user);
     }
 }
 
-void onReport(DecodedReport report)
+void onReport(const CompactReport* report)
 {
-    DecodedReport* buff;
-    if (platform_malloc((void**)&buff, sizeof(DecodedReport)) != MEM_OK) {
-        printf("[onReport] ERROR: malloc failed\n");
-        return;
+    //zadnje stanje se ažurira u mjestu, neovisno o tome čita li itko ring reporta
+    app_mmwave_state_update(report);
+
+    if(report->kind == REPORT_KIND_INIT_COMPLETED) {
+        ready_update(true);
     }
 
-    *buff = report;
+    //ring je pun -> najstariji report je prepisan
+    if(!app_event_ring_push(&app_report_ring, report)) {
+        printf("[onReport] WARNING: Ring full, oldest overwritten!\n");
+    }
+    PLATFORM_TRACE(PLATFORM_TRACE_QUEUE_SEND, sizeof(CompactReport));
 
-    platform_lock_mutex(report_queue_mutex, UINT32_MAX);
-    if(platform_queue_send(app_report_queue, (QueueElement_t*)&buff, 0) != QUEUE_OK) {
-        //Queue je pun -> mičemo najstariji report
-        printf("[onReport] WARNING: Queue full, removing oldest!\n");
-        DecodedReport* garbage;
-        platform_queue_get(app_report_queue, (QueueElement_t*)&garbage, 0);
-        platform_free(garbage);
-        if(platform_queue_send(app_report_queue, (QueueElement_t*)&buff, 0) != QUEUE_OK) {
-            printf("[onReport] ERROR: queue_send failed\n");
-            platform_free(buff);
-        }
+    MmwaveSubscription subs[APP_MAX_SUBSCRIBERS];
+    size_t n = subscribers_snapshot(MMWAVE_EVENT_MASK_REPORT(report->kind), subs);
+    if(!higher_app_report_callback && n == 0) {
+        return;
     }
-    platform_unlock_mutex(report_queue_mutex);
 
+    //vanjski program i pretplatnici dobivaju kompatibilni DecodedReport, pretvoren samo jednom
+    DecodedReport decoded;
+    app_mmwave_decoder_expand_report(report, &decoded);
     if(higher_app_report_callback) {
-        higher_app_report_callback(report);
+        higher_app_report_callback(decoded);
+    }
+    for(size_t i = 0; i < n; i++) {
+        subs[i].on_report(&decoded, subs[i].user);
     }
 }
 
@@ -347,6 +603,23 @@ bool app_get_system_snapshot(SystemSnapshot* snapshot)
         snapshot->tasks[i].remaining_stack = tasks[i].remaining_stack;
     }
 
+    PlatformTimingStats_t parse_timing;
+    hal_mmwave_get_parse_timing(&parse_timing);
+    PlatformTimingStats_t decode_copy = decode_timing;
+    snapshot->parse_avg_ns = (parse_timing.count > 0) ?
+        platform_cycles_to_ns(parse_timing.total_cycles / parse_timing.count) : 0;
+    snapshot->parse_max_ns = platform_cycles_to_ns(parse_timing.max_cycles);
+    snapshot->decode_avg_ns = (decode_copy.count > 0) ?
+        platform_cycles_to_ns(decode_copy.total_cycles / decode_copy.count) : 0;
+    snapshot->decode_max_ns = platform_cycles_to_ns(decode_copy.max_cycles);
+
+    HalRxMetrics_t rx_metrics;
+    hal_mmwave_get_rx_metrics(&rx_metrics);
+    snapshot->rx_thresh = rx_metrics.rx_thresh;
+    snapshot->rx_timeout = rx_metrics.rx_timeout;
+    snapshot->rx_wakeups_per_frame_x100 = rx_metrics.wakeups_per_frame_x100;
+    snapshot->rx_overflows = rx_metrics.fifo_overflows + rx_metrics.buffer_full_events;
+
     snapshot->timestamp = (platform_getNumOfMs() / 1000);
     return true;
 }
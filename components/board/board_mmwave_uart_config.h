@@ -58,8 +58,39 @@
  */
 #define RX_THRESH 10
 
+/**
+ * @brief Početni RX timeout u trajanju UART simbola (tišina na liniji nakon koje se šalje UART DATA event).
+ * 
+ */
+#define RX_TIMEOUT 10
+
+/**
+ * @brief Prilagođava li HAL RX threshold i RX timeout tijekom rada prema opaženom prometu (1) ili su fiksni (0).
+ * 
+ */
+#define RX_ADAPTIVE 1
+
+/**
+ * @brief Budi li se HAL RX task na završnom bajtu frame-a (1) umjesto na RX threshold/timeout (0).
+ * 
+ * @note Način je samo savjetodavan (buđenje, ne granica frame-a). Pattern detekcija ESP32 UART-a prepoznaje
+ * samo niz istih znakova, pa se ne može detektirati cijeli završetak FOOTER1 FOOTER2, a driver nema
+ * uvid u RX buffer (peek) kojim bi se prije čitanja provjerio FOOTER1 ispred položaja. Zato svaki bajt
+ * FOOTER2 (0x43) unutar payload-a daje dodatno buđenje i kraće čitanje. Frame-ovi ostaju ispravni jer
+ * parser podatke obrađuje kao tok, a dodatna buđenja vide se u rx_wakeups_per_frame (iznad 1.00).
+ */
+#define FRAME_END_DETECTION 0
+
 /**
  * @brief Veličina queue-a za UART eventove.
  * 
  */
-#define EVENT_QUEUE_LEN 20
\ No newline at end of file
+#define EVENT_QUEUE_LEN 20
+
+/**
+ * @brief Način dohvata UART evenata u HAL-u.
+ * 
+ * 1 - HAL RX task čeka direktno na UART event queue-u drivera (bez dispatcher taska),
+ * 0 - eventi prolaze kroz platform dispatcher task i platform event queue.
+ */
+#define DIRECT_UART_EVENTS 1
\ No newline at end of file
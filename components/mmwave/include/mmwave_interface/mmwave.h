@@ -72,4 +72,14 @@ mmwave_status_t mmwave_core_init(void);
  * 
  * @return Status operacije nad modulom
  */
-mmwave_status_t mmwave_core_stop(void);
\ No newline at end of file
+mmwave_status_t mmwave_core_stop(void);
+
+/**
+ * @brief Odbacuje djelomično izgrađeni frame i vraća parser na traženje početka frame-a.
+ * 
+ * Interni bufferi se ne oslobađaju niti realociraju - funkcija je brza i sigurna za poziv
+ * iz RX taska nakon gubitka podataka na ulazu.
+ * 
+ * @return Status operacije nad modulom
+ */
+mmwave_status_t mmwave_core_reset(void);
\ No newline at end of file
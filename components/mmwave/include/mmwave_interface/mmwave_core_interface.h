@@ -126,6 +126,19 @@ typedef mmwave_status_t (*mmWave_init)(void);
  */
 typedef mmwave_status_t (*mmWave_stop)(void);
 
+/**
+ * @brief Public API callback mmWave core sloja za odbacivanje djelomično izgrađenog frame-a.
+ * 
+ * Funkcija vraća parser na traženje početka frame-a bez oslobađanja internih buffera. Koristi se
+ * kod oporavka nakon gubitka podataka na ulazu (npr. preljev UART buffera).
+ * 
+ * Funkciju implementira mmWave core sloj.
+ * 
+ * @return Status operacije nad core parserom
+ * 
+ */
+typedef mmwave_status_t (*mmWave_reset)(void);
+
 /**
  * @struct mmWave_core_callback
  * @brief Strukutra callbackova koje implementira HAL sloj.
@@ -155,6 +168,7 @@ typedef struct
     mmWave_build_frame mmwave_build_frame;
     mmWave_init mmwave_core_init;
     mmWave_stop mmwave_core_stop;
+    mmWave_reset mmwave_core_reset;
 } mmWave_core_interface;
 
 /**
@@ -139,6 +139,18 @@ mmwave_status_t mmwave_core_stop(void)
     return S_MMWAVE_OK;
 }
 
+mmwave_status_t mmwave_core_reset(void)
+{
+    if(!hal_functions) {
+        return S_MMWAVE_ERR_TIMEOUT;
+    }
+    head1 = false;
+    head2 = false;
+    built_frame_len = 0;
+    payload_len = 0;
+    return S_MMWAVE_OK;
+}
+
 /**
  * @brief Interna funkcija za parsiranje ulaznih podataka.
  * 
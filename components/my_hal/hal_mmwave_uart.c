@@ -34,6 +34,7 @@
 #include "platform/platform_task.h"
 #include "platform/platform_mutex.h"
 #include "platform/platform_queue.h"
+#include "platform/platform_signal.h"
 #include "my_hal/system_monitor.h"
 
 /**
@@ -50,10 +51,42 @@
  */
 #define MAX_TOTAL_ALLOC 32768
 
+/**
+ * @brief Veličina stacka RX i TX taska u bajtovima.
+ * 
+ */
+#define HAL_TASK_STACK_SIZE 12000
+
+/**
+ * @brief Najdulje vrijeme (u ms) koje RX/TX task blokira na svom queue-u prije ponovne provjere kraja rada.
+ * 
+ */
+#define HAL_TASK_WAIT_MS 200
+
+/**
+ * @brief Period (u ms) u kojem RX task ponovno procjenjuje RX threshold i RX timeout.
+ * 
+ */
+#define HAL_RX_ADAPT_PERIOD_MS 1000
+
+#define HAL_RX_THRESH_MIN 8 /**< Najmanji RX threshold koji prilagodba smije postaviti */
+#define HAL_RX_THRESH_MAX 100 /**< Najveći RX threshold (ispod 128 B hardverskog RX FIFO-a) */
+#define HAL_RX_BUSY_FPS 10 /**< Broj frame-ova u sekundi od kojeg se linija smatra opterećenom */
+#define HAL_RX_BUSY_FRAMES_PER_WAKE 4 /**< Koliko frame-ova pod opterećenjem smije stati u jedno buđenje */
+#define HAL_RX_TIMEOUT_QUIET 2 /**< RX timeout (u simbolima) na mirnoj liniji - najmanja latencija pojedinog frame-a */
+#define HAL_RX_TIMEOUT_BUSY 10 /**< RX timeout (u simbolima) pod opterećenjem - spajanje frame-ova koji stižu jedan za drugim */
+//Pretpostavka (nije mjereno): senzor frame-ove jednog naleta reporta šalje uzastopno, s razmakom od nekoliko simbola, a
+//naleti su desecima ms udaljeni. Na 115200 baud (8N1) simbol traje ~87 us, pa 10 simbola (~0.9 ms) spaja frame-ove naleta,
+//a ne čeka sljedeći nalet. Kod frame-ova s većim razmakom (npr. pojedinačni odgovori) ne smanjuje broj buđenja.
+
+#define HAL_SIGNAL_RUNNING (1 << 0) /**< HAL je u stanju RUNNING - RX i TX task smiju raditi */
+#define HAL_SIGNAL_RX_ENDED (1 << 1) /**< RX task je završio s radom */
+#define HAL_SIGNAL_TX_ENDED (1 << 2) /**< TX task je završio s radom */
+#define HAL_SIGNAL_STOP_REQ (1 << 3) /**< Zatraženo zaustavljanje (kraj rada u direktnom načinu) */
+
 static MutexHandle_t mutex; /**< Mutex za zaštitu heap memorije */
 static size_t currently_allocated_mem = 0; /**< Brojač ukupno zauzete memorije na heapu */
-static volatile bool flag1 = false; /**< Signal završetka RX taska */
-static volatile bool flag2 = false; /**< Signal završetka TX taska */
+static PlatformSignalHandle hal_signal = NULL; /**< Signali stanja HAL-a i završetka RX/TX taskova */
 static HalEventHandle_t event_queue = NULL; /**< Queue s platform UART eventima */
 static HalMmwaveState current_state = HAL_MMWAVE_UNINIT; /**< Trenutno stanje HAL state machine-a */
 static task_handler rx_task = NULL; /**< Pokazivač na task koji čita eventove i dobiva parsirane frame-ove */
@@ -63,6 +96,30 @@ static mmWave_core_interface* mmwave_core_API = NULL; /**< mmWave core API -> po
 static mmWave_core_callback mmwave_core_callback; /**< Callbackovi na HAL naredbe -> zvat će ih mmWave_core */
 static PlatformQueueHandle frame_queue = NULL; /**< Queue za primljene frame-ove */
 static PlatformQueueHandle tx_queue = NULL; /**< Queue koji se koristi za TX frame-ove */
+static bool direct_events = false; /**< RX task čeka direktno na UART eventima drivera (bez dispatcher taska) */
+static bool rx_adaptive = false; /**< RX threshold i timeout se prilagođavaju prometu */
+static uint32_t rx_thresh = 0; /**< Trenutni RX threshold */
+static uint32_t rx_timeout = 0; /**< Trenutni RX timeout u simbolima */
+static uint32_t rx_wakeups = 0; /**< Broj RX_DATA evenata od pokretanja (piše samo RX task) */
+static uint32_t rx_frames = 0; /**< Broj parsiranih frame-ova od pokretanja (piše samo RX task preko _saveFrame) */
+static uint32_t rx_fifo_overflows = 0; /**< Broj preljeva RX FIFO-a od pokretanja (piše samo RX task) */
+static uint32_t rx_buffer_full_events = 0; /**< Broj popunjenja RX buffera od pokretanja (piše samo RX task) */
+static HalOverflowCallback overflow_callback = NULL; /**< Callback nakon oporavka od preljeva na ulazu */
+
+//Statička memorija za taskove, queue-ove i mutex - ponovljeni start/stop ne fragmentira heap
+static PlatformStaticMutex_t mutex_buffer;
+static PlatformStaticSignal_t hal_signal_buffer;
+
+static PlatformTimingStats_t parse_timing; /**< Statistika trajanja parsiranja jednog RX chunka (ažurira samo RX task) */
+static uint8_t frame_queue_storage[MAX_FRAMES_IN_QUEUE * sizeof(FrameData_t)];
+static PlatformStaticQueue_t frame_queue_buffer;
+static uint8_t tx_queue_storage[MAX_FRAMES_IN_QUEUE * sizeof(FrameData_t)];
+static PlatformStaticQueue_t tx_queue_buffer;
+static uint8_t rx_task_stack[HAL_TASK_STACK_SIZE];
+static PlatformStaticTask_t rx_task_buffer;
+static uint8_t tx_task_stack[HAL_TASK_STACK_SIZE];
+static PlatformStaticTask_t tx_task_buffer;
+static uint8_t rx_tmp_buff[512]; /**< Buffer za čitanje iz UART RX buffera (koristi samo RX task) */
 
 /**
  * @brief Implementacija callback funkcije za spremanje semantički korisnih podataka iz parsiranog frame-a.
@@ -80,6 +137,8 @@ static bool _saveFrame(mmWaveFrameSemanticData* frame_data)
     QueueOperationStatus qos;
 
     if(frame_data != NULL && frame_queue != NULL) {
+        rx_frames++;
+        PLATFORM_TRACE(PLATFORM_TRACE_FRAME, frame_data->len);
         FrameData_t new_frame_data = {
             .data = frame_data->data,
             .len = frame_data->len
@@ -90,6 +149,7 @@ static bool _saveFrame(mmWaveFrameSemanticData* frame_data)
             printf("[HAL] saveFrame FAILED (queue full)\n"); //KASNIJE MAKNUTI
             return false;
         }
+        PLATFORM_TRACE(PLATFORM_TRACE_QUEUE_SEND, frame_data->len);
         return true;
     }
     return false;
@@ -154,6 +214,115 @@ static void hal_free(uint8_t* mem, size_t size_of_mem)
     return;
 }
 
+/**
+ * @brief Čeka sljedeći UART event - direktno na driveru ili preko platform event queue-a dispatchera.
+ * 
+ * @param event Pokazivač na strukturu u koju se sprema event
+ * @param timeout_in_ms Vrijeme čekanja u ms
+ * @return Status dohvata eventa
+ */
+static EventStatus hal_wait_uart_event(PlatformEvent_t* event, uint32_t timeout_in_ms)
+{
+    if(direct_events) {
+        return platform_uart_event_wait(event, timeout_in_ms);
+    }
+    return platform_event_wait(event_queue, event, timeout_in_ms);
+}
+
+/**
+ * @brief Provjerava je li izvor UART evenata završio, tj. smiju li RX i TX task završiti s radom.
+ * 
+ * U načinu s dispatcherom to je završetak dispatcher taska, a u direktnom načinu zahtjev za zaustavljanjem.
+ * 
+ * @return true ako je izvor evenata završio
+ * @return false ako izvor evenata još radi
+ */
+static bool hal_event_source_ended(void)
+{
+    if(direct_events) {
+        return (platform_signal_get(hal_signal) & HAL_SIGNAL_STOP_REQ) != 0;
+    }
+    return platform_uart_event_converter_ended();
+}
+
+/**
+ * @brief Vraća broj UART evenata koji još čekaju na obradu u RX tasku.
+ * 
+ * @return Broj evenata koji čekaju
+ */
+static size_t hal_pending_uart_events(void)
+{
+    if(direct_events) {
+        return platform_uart_get_num_of_pending_events();
+    }
+    return platform_get_num_of_queue_elements(event_queue);
+}
+
+/**
+ * @brief Prilagođava RX threshold i RX timeout prometu opaženom u proteklom periodu.
+ * 
+ * Na mirnoj liniji threshold prati prosječnu duljinu frame-a (jedan frame - jedno buđenje), a kratki timeout
+ * isporučuje pojedini frame čim linija utihne. Pod opterećenjem threshold raste na nekoliko frame-ova, a dulji
+ * timeout spaja frame-ove koji stižu jedan za drugim - manje buđenja po frame-u.
+ * 
+ * @param frames Broj frame-ova u proteklom periodu
+ * @param bytes Broj primljenih bajtova u proteklom periodu
+ * @param period_ms Trajanje proteklog perioda u ms
+ */
+static void hal_rx_adapt(uint32_t frames, uint32_t bytes, uint32_t period_ms)
+{
+    if(frames == 0 || period_ms == 0) {
+        return; //nema prometa - zadržavamo zadnje postavke
+    }
+    uint32_t avg_len = bytes / frames;
+    bool busy = ((frames * 1000) / period_ms) >= HAL_RX_BUSY_FPS;
+
+    uint32_t new_thresh = busy ? (avg_len * HAL_RX_BUSY_FRAMES_PER_WAKE) : avg_len;
+    if(new_thresh < HAL_RX_THRESH_MIN) {
+        new_thresh = HAL_RX_THRESH_MIN;
+    } else if(new_thresh > HAL_RX_THRESH_MAX) {
+        new_thresh = HAL_RX_THRESH_MAX;
+    }
+    uint32_t new_timeout = busy ? HAL_RX_TIMEOUT_BUSY : HAL_RX_TIMEOUT_QUIET;
+
+    if(new_thresh != rx_thresh && platform_uart_set_rx_threshold(current_board_id, new_thresh) == UART_OK) {
+        rx_thresh = new_thresh;
+    }
+    if(new_timeout != rx_timeout && platform_uart_set_rx_timeout(current_board_id, new_timeout) == UART_OK) {
+        rx_timeout = new_timeout;
+    }
+}
+
+/**
+ * @brief Oporavak nakon preljeva RX FIFO-a ili RX buffera.
+ * 
+ * Nakon preljeva dio bajtova je izgubljen, a eventi u queue-u više ne odgovaraju podatcima u bufferu.
+ * Odbacuju se svi primljeni bajtovi i eventi te djelomično izgrađeni frame u parseru - prvi sljedeći
+ * cijeli frame ponovno se ispravno parsira.
+ * 
+ * @param type Vrsta preljeva
+ */
+static void hal_rx_overflow_recover(HalOverflowType type)
+{
+    platform_uart_flush_input(current_board_id);
+    if(mmwave_core_API->mmwave_core_reset != NULL) {
+        mmwave_core_API->mmwave_core_reset();
+    }
+
+    uint32_t count;
+    if(type == HAL_OVERFLOW_FIFO) {
+        count = ++rx_fifo_overflows;
+    } else {
+        count = ++rx_buffer_full_events;
+    }
+    printf("[HAL RX] preljev ulaza (tip %d, ukupno %lu) - oporavak\n", type, (unsigned long)count);
+
+    HalOverflowCallback cb = overflow_callback;
+    if(cb != NULL) {
+        cb(type, count);
+    }
+}
+
 /**
  * @brief Task za obradu UART RX event-ova.
  * 
@@ -162,51 +331,87 @@ static void hal_free(uint8_t* mem, size_t size_of_mem)
  * 
  * Parsirani frame-ovi se preko HAL callbacka iz mmWave core sloja spremaju u frame queue.
  * 
+ * U direktnom načinu (direct_events) task čeka direktno na UART event queue-u drivera, a event se prevodi
+ * u kontekstu ovog taska.
+ * 
  * Task će se sam ugasiti i osloboditi zauzete resurse kada dispatcher task (definiran u platform sloju)
- * završi i isprazne se svi do tada dodani eventi iz event queue.
+ * završi (u direktnom načinu: kada je zatraženo zaustavljanje) i isprazne se svi do tada dodani eventi
+ * iz event queue. Završetak javlja signalom HAL_SIGNAL_RX_ENDED, nakon čega blokira dok ga hal_mmwave_stop() ne obriše.
+ * 
+ * Ako je uključena prilagodba (rx_adaptive), task svakih HAL_RX_ADAPT_PERIOD_MS prilagođava RX threshold i timeout.
+ * 
+ * Ako je uključena detekcija kraja frame-a (frame_end_detection), task se budi na PLATFORM_EVENT_FRAME_END
+ * i čita točno do granice frame-a - u pravilu jedno buđenje po frame-u (završni bajt unutar payload-a
+ * daje dodatno buđenje s kraćim čitanjem, a parser podatke obrađuje kao tok).
  * 
- * @note Trenutno se obrađuju samo PLATFORM_EVENT_RX_DATA eventi, ostali tipovi se samo preskaču.
+ * Kod PLATFORM_EVENT_FIFO_OVF i PLATFORM_EVENT_BUFFER_FULL provodi se oporavak (hal_rx_overflow_recover()).
+ * 
+ * @note Ostali tipovi evenata (osim PLATFORM_EVENT_NONE) se samo preskaču.
+ * PLATFORM_EVENT_NONE dispatcher šalje kada završava s radom, a u direktnom načinu dolazi kod gašenja ISR-a.
  * 
  * @param arg Ne koristi se
  */
 static void hal_receive_task(void* arg)
 {
     PlatformEvent_t buff;
+    uint32_t adapt_start = platform_getNumOfMs();
+    uint32_t adapt_frames = 0;
+    uint32_t adapt_bytes = 0;
+    //čekamo da hal_mmwave_start() završi prijelaz u RUNNING
+    platform_signal_wait(hal_signal, HAL_SIGNAL_RUNNING, true, false, PLATFORM_SIGNAL_WAIT_FOREVER);
     for(;;) {
-        if(current_state != HAL_MMWAVE_RUNNING) {
-            platform_delay_task(20);
-            continue;
+        if(rx_adaptive && (platform_getNumOfMs() - adapt_start) >= HAL_RX_ADAPT_PERIOD_MS) {
+            hal_rx_adapt(rx_frames - adapt_frames, adapt_bytes, platform_getNumOfMs() - adapt_start);
+            adapt_start = platform_getNumOfMs();
+            adapt_frames = rx_frames;
+            adapt_bytes = 0;
         }
-        if(platform_event_wait(event_queue, &buff, 200) == PLATFORM_EVENT_OK) {
+        if(hal_wait_uart_event(&buff, HAL_TASK_WAIT_MS) == PLATFORM_EVENT_OK) {
+            PLATFORM_TRACE(PLATFORM_TRACE_TASK_WAKE, buff.type);
             //sad imamo event i ovisno o eventu radimo operaciju:
-            static uint8_t rx_tmp_buff[512];
-            if(buff.type == PLATFORM_EVENT_RX_DATA && buff.len > 0) {
-                if(buff.len > 512) {
-                    printf("[HAL RX] ERROR: event len=%d prelazi velicinu buffer-a\n", buff.len);
-                    continue;
-                }
-                int read_len = platform_uart_read(current_board_id, rx_tmp_buff, buff.len, 20);
-                if(read_len <= 0) {
-                    printf("[HAL RX] ERROR: uart read vratio %d\n", read_len);
-                    continue;
+            if((buff.type == PLATFORM_EVENT_RX_DATA && buff.len > 0) || buff.type == PLATFORM_EVENT_FRAME_END) {
+                //kod kraja frame-a čitamo točno do granice frame-a (uključujući završni bajt)
+                size_t remaining = (buff.type == PLATFORM_EVENT_FRAME_END) ?
+                    platform_uart_get_frame_end_len(current_board_id) : buff.len;
+                //prazan RX buffer ne smije preskočiti provjeru kraja rada ispod
+                if(remaining > 0) {
+                    rx_wakeups++;
                 }
-                //pošalji na parsiranje
-                if(read_len > 0) {
-                    mmwave_core_API->mmwave_parse_data(rx_tmp_buff, read_len);
+                while(remaining > 0) {
+                    size_t chunk = (remaining > sizeof(rx_tmp_buff)) ? sizeof(rx_tmp_buff) : remaining;
+                    int read_len = platform_uart_read(current_board_id, rx_tmp_buff, chunk, 20);
+                    if(read_len <= 0) {
+                        printf("[HAL RX] ERROR: uart read vratio %d\n", read_len);
+                        break;
+                    }
+                    adapt_bytes += read_len;
+                    remaining -= read_len;
+                    //pošalji na parsiranje
+                    PLATFORM_TRACE(PLATFORM_TRACE_PARSE_BEGIN, read_len);
+                    {
+                        PLATFORM_TIMING_SCOPE(&parse_timing);
+                        mmwave_core_API->mmwave_parse_data(rx_tmp_buff, read_len);
+                    }
+                    PLATFORM_TRACE(PLATFORM_TRACE_PARSE_END, read_len);
                     //kada se izparsira bit će u frame_queue - koristi application layer
                 }
-            } else {
-                continue;
+            } else if(buff.type == PLATFORM_EVENT_FIFO_OVF) {
+                hal_rx_overflow_recover(HAL_OVERFLOW_FIFO);
+            } else if(buff.type == PLATFORM_EVENT_BUFFER_FULL) {
+                hal_rx_overflow_recover(HAL_OVERFLOW_BUFFER_FULL);
+            } else if(buff.type == PLATFORM_EVENT_NONE) {
+                //dispatcher završava - pričekamo njegov signal umjesto ponovnog kruga kroz timeout
+                //(u direktnom načinu NONE je buđenje kod gašenja ISR-a - odmah provjeravamo kraj rada)
+                if(!direct_events) {
+                    platform_uart_event_converter_wait_ended(HAL_TASK_WAIT_MS);
+                }
             }
-        } else {
-            platform_delay_task(20);
         }
-        if(hal_dispatcher_ended_flag && (platform_get_num_of_queue_elements(event_queue) == 0)) {
-            printf("[HAL RX] zavrsio s radom (flag1 = true)\n");
+        if(hal_event_source_ended() && (hal_pending_uart_events() == 0)) {
+            printf("[HAL RX] zavrsio s radom\n");
             system_monitor_unregister_task(rx_task);
-            flag1 = true;
-            rx_task = NULL;
-            platform_delete_task(NULL); //task postavlja flag1 (da je završio) i briše sam sebe
+            platform_signal_set(hal_signal, HAL_SIGNAL_RX_ENDED);
+            platform_park_task(); //task signalizira da je završio, a briše ga hal_mmwave_stop()
         }
     }
 }
@@ -218,32 +423,29 @@ static void hal_receive_task(void* arg)
  * koja je bila alocirana za frame.
  * 
  * Task će se sam ugasiti i osloboditi zauzete resurse kada dispatcher task (definiran u platform sloju)
- * završi i isprazne se svi do tada dodani frame-ovi iz tx_queue.
+ * završi (u direktnom načinu: kada je zatraženo zaustavljanje) i isprazne se svi do tada dodani frame-ovi iz tx_queue. Završetak javlja signalom HAL_SIGNAL_TX_ENDED, nakon čega blokira dok ga hal_mmwave_stop() ne obriše.
+ * 
+ * @note Frame s data == NULL je prazan (wake) frame kojim hal_mmwave_stop() budi task.
  * 
  * @param arg Ne koristi se
  */
 static void hal_send_task(void* arg)
 {
     QueueElement_t buff;
+    //čekamo da hal_mmwave_start() završi prijelaz u RUNNING
+    platform_signal_wait(hal_signal, HAL_SIGNAL_RUNNING, true, false, PLATFORM_SIGNAL_WAIT_FOREVER);
     for(;;) {
-        if(current_state != HAL_MMWAVE_RUNNING) {
-            platform_delay_task(20);
-            continue;
-        }
-
-        if(platform_queue_get(tx_queue, &buff, 20) == QUEUE_OK) {
+        if(platform_queue_get(tx_queue, &buff, HAL_TASK_WAIT_MS) == QUEUE_OK && buff.data != NULL) {
             //printf("[HAL TX TASK] buff.data=%p len=%d\n", buff.data, buff.len);
+            PLATFORM_TRACE(PLATFORM_TRACE_UART_TX, buff.len);
             platform_uart_write(current_board_id, buff.data, buff.len);
             platform_free(buff.data);
-        } else {
-            platform_delay_task(20);
         }
-        if(hal_dispatcher_ended_flag && (platform_get_num_of_queue_elements(tx_queue) == 0)) {
-            printf("[HAL TX TASK] zavrsio s radom (flag2 = true)\n");
+        if(hal_event_source_ended() && (platform_get_num_of_queue_elements(tx_queue) == 0)) {
+            printf("[HAL TX TASK] zavrsio s radom\n");
             system_monitor_unregister_task(tx_task);
-            flag2 = true;
-            tx_task = NULL;
-            platform_delete_task(NULL);
+            platform_signal_set(hal_signal, HAL_SIGNAL_TX_ENDED);
+            platform_park_task();
         }
     }
 }
@@ -259,10 +461,17 @@ HalMmwaveStatus hal_mmwave_init(hal_mmwave_config* configuration, mmWave_core_in
         return HAL_ERROR;
     }
 
-    mutex = platform_create_mutex();
+    mutex = platform_create_mutex_static(&mutex_buffer);
+    hal_signal = platform_signal_create_static(&hal_signal_buffer);
+    if(mutex == NULL || hal_signal == NULL) {
+        return HAL_ERROR;
+    }
 
     current_board_id = configuration->id;
     mmwave_core_API = core_api;
+    direct_events = configuration->direct_events;
+    //kod detekcije kraja frame-a buđenja određuju granice frame-a, a ne threshold i timeout
+    rx_adaptive = configuration->rx_adaptive && !configuration->frame_end_detection;
 
     {
         //dajemo strukturi callbackova pokazivače na HAL funkcije
@@ -297,11 +506,29 @@ HalMmwaveStatus hal_mmwave_init(hal_mmwave_config* configuration, mmWave_core_in
     if(us != UART_OK) {
         return HAL_ERROR;
     }
+    us = platform_uart_set_rx_timeout(configuration->id, configuration->rx_timeout);
+    if(us != UART_OK) {
+        return HAL_ERROR;
+    }
+    rx_thresh = configuration->rx_thresh;
+    rx_timeout = configuration->rx_timeout;
+
+    if(configuration->frame_end_detection) {
+        //threshold samo služi za pražnjenje FIFO-a kod dugih nizova, timeout gasi platform sloj
+        if(platform_uart_set_rx_threshold(configuration->id, HAL_RX_THRESH_MAX) != UART_OK ||
+                platform_uart_enable_frame_end_detection(configuration->id, configuration->frame_tail_byte) != UART_OK) {
+            return HAL_ERROR;
+        }
+        rx_thresh = HAL_RX_THRESH_MAX;
+        rx_timeout = 0;
+    }
 
     event_queue = platform_uart_get_event_queue();
 
-    frame_queue = platform_queue_create(MAX_FRAMES_IN_QUEUE, sizeof(FrameData_t));
-    tx_queue = platform_queue_create(MAX_FRAMES_IN_QUEUE, sizeof(FrameData_t));
+    frame_queue = platform_queue_create_static(MAX_FRAMES_IN_QUEUE, sizeof(FrameData_t), frame_queue_storage,
+        &frame_queue_buffer);
+    tx_queue = platform_queue_create_static(MAX_FRAMES_IN_QUEUE, sizeof(FrameData_t), tx_queue_storage,
+        &tx_queue_buffer);
 
     current_state = HAL_MMWAVE_INIT;
     return HAL_MMWAVE_OK;
@@ -313,30 +540,40 @@ HalMmwaveStatus hal_mmwave_start(void)
     if(current_state != HAL_MMWAVE_INIT && current_state != HAL_MMWAVE_STOPPED) {
         return HAL_MMWAVE_INVALID_STATE;
     }
-    //Obnova flagova da ništa nije završilo od taskova:
-    flag1 = false;
-    flag2 = false;
-    hal_dispatcher_ended_flag = false;
+    platform_timing_reset(&parse_timing);
+    rx_wakeups = 0;
+    rx_frames = 0;
+    rx_fifo_overflows = 0;
+    rx_buffer_full_events = 0;
+    //Obnova signala da ništa nije završilo od taskova:
+    platform_signal_clear(hal_signal, HAL_SIGNAL_RUNNING | HAL_SIGNAL_RX_ENDED | HAL_SIGNAL_TX_ENDED |
+        HAL_SIGNAL_STOP_REQ);
     //Dozvoljavanje RX uart prekida:
     us = platform_ISR_enable(current_board_id);
     if(us != UART_OK) {
         return HAL_ERROR;
     }
-    //Pokretanje converter taska u platform layeru:
-    us = platform_uart_event_converter_start(current_board_id);
+    if(direct_events) {
+        //Direktni način - nema converter taska, samo fresh start RX buffera i UART event queue-a:
+        us = platform_uart_flush_input(current_board_id);
+    } else {
+        //Pokretanje converter taska u platform layeru:
+        us = platform_uart_event_converter_start(current_board_id);
+    }
     if(us != UART_OK) {
         return HAL_ERROR;
     }
     //Pokretanje taska za prepoznavanje eventova, slanje na TX i primanje reportova:
-    TaskConfig_t rx1 = {hal_receive_task, "rx_task", 12000, NULL, 5};
-    rx_task = platform_create_task(&rx1);
+    TaskConfig_t rx1 = {hal_receive_task, "rx_task", HAL_TASK_STACK_SIZE, NULL, 5, PLATFORM_TASK_CORE_SENSOR};
+    rx_task = platform_create_task_static(&rx1, rx_task_stack, &rx_task_buffer);
     system_monitor_register_task("rx", rx_task);
     //Pokretanje taska za slanje frame-ova u TX:
-    TaskConfig_t tx1 = {hal_send_task, "tx_task", 12000, NULL, 5};
-    tx_task = platform_create_task(&tx1);
+    TaskConfig_t tx1 = {hal_send_task, "tx_task", HAL_TASK_STACK_SIZE, NULL, 5, PLATFORM_TASK_CORE_SENSOR};
+    tx_task = platform_create_task_static(&tx1, tx_task_stack, &tx_task_buffer);
     system_monitor_register_task("tx", tx_task);
 
     current_state = HAL_MMWAVE_RUNNING;
+    platform_signal_set(hal_signal, HAL_SIGNAL_RUNNING);
     return HAL_MMWAVE_OK;
 }
 
@@ -346,15 +583,28 @@ HalMmwaveStatus hal_mmwave_stop(void)
     if(current_state != HAL_MMWAVE_RUNNING) {
         return HAL_MMWAVE_INVALID_STATE;
     }
-    //Prvo gasimo ISR - mora prestati slanje uart_eventova:
+    //U direktnom načinu zahtjev za zaustavljanje je kraj izvora evenata - RX task prazni preostale evente i završava
+    platform_signal_set(hal_signal, HAL_SIGNAL_STOP_REQ);
+    //Prvo gasimo ISR - mora prestati slanje uart_eventova (ujedno budi onoga tko čeka na UART eventima):
     us = platform_ISR_disable(current_board_id);
     if(us != UART_OK) {
+        platform_signal_clear(hal_signal, HAL_SIGNAL_STOP_REQ);
         return HAL_ERROR;
     }
-    //Svi taskovi moraju prestati da ih možemo obrisati:
-    while(!flag1 || !flag2 || !hal_dispatcher_ended_flag) {
-        platform_delay_task(1);
-    }
+    //Svi taskovi moraju prestati da ih možemo obrisati - čekamo dispatcher, pa RX i TX task:
+    if(!direct_events) {
+        platform_uart_event_converter_wait_ended(PLATFORM_SIGNAL_WAIT_FOREVER);
+    }
+    FrameData_t wake_frame = {NULL, 0};
+    platform_queue_send(tx_queue, &wake_frame, 0); //budimo TX task da odmah provjeri kraj rada
+    platform_signal_wait(hal_signal, HAL_SIGNAL_RX_ENDED | HAL_SIGNAL_TX_ENDED, true, false,
+        PLATFORM_SIGNAL_WAIT_FOREVER);
+    //taskovi su javili završetak i blokirani su - brišemo ih prije nego start ponovno iskoristi njihovu memoriju
+    platform_delete_task(rx_task);
+    rx_task = NULL;
+    platform_delete_task(tx_task);
+    tx_task = NULL;
+    platform_signal_clear(hal_signal, HAL_SIGNAL_RUNNING);
     //Na kraju STOP core-a
     mmwave_core_API->mmwave_core_stop();
 
@@ -369,9 +619,7 @@ HalMmwaveStatus hal_mmwave_deinit(void)
         return HAL_MMWAVE_INVALID_STATE;
     }
 
-    while(rx_task != NULL || tx_task != NULL) {
-        platform_delay_task(50);
-    }
+    //u stanju STOPPED RX i TX task su već javili završetak (hal_mmwave_stop), a u INIT nisu ni pokrenuti
 
     us = platform_uart_deinit(current_board_id);
     if(us != UART_OK) {
@@ -399,6 +647,10 @@ HalMmwaveStatus hal_mmwave_deinit(void)
         platform_delete_mutex(mutex);
         mutex = NULL;
     }
+    if(hal_signal) {
+        platform_signal_delete(hal_signal);
+        hal_signal = NULL;
+    }
     current_board_id = BOARD_UART_UNINIT;
     mmwave_core_API = NULL;
 
@@ -452,6 +704,7 @@ HalMmwaveStatus hal_mmwave_get_frame_from_queue(FrameData_t* buffer, uint32_t ti
     if(status != QUEUE_OK) {
         return HAL_ERROR;
     }
+    PLATFORM_TRACE(PLATFORM_TRACE_QUEUE_RECV, buffer->len);
     return HAL_MMWAVE_OK;
 }
 
@@ -467,4 +720,58 @@ void hal_mmwave_flush_frames(void)
         hal_mmwave_release_frame_memory(&tmp);
     }
     return;
+}
+
+void hal_mmwave_get_parse_timing(PlatformTimingStats_t* stats)
+{
+    if(stats != NULL) {
+        *stats = parse_timing;
+    }
+}
+
+void hal_mmwave_get_rx_metrics(HalRxMetrics_t* metrics)
+{
+    if(metrics == NULL) {
+        return;
+    }
+    metrics->rx_thresh = rx_thresh;
+    metrics->rx_timeout = rx_timeout;
+    metrics->wakeups = rx_wakeups;
+    metrics->frames = rx_frames;
+    metrics->wakeups_per_frame_x100 = (rx_frames > 0) ? (uint32_t)(((uint64_t)rx_wakeups * 100) / rx_frames) : 0;
+    metrics->fifo_overflows = rx_fifo_overflows;
+    metrics->buffer_full_events = rx_buffer_full_events;
+}
+
+void hal_mmwave_register_overflow_callback(HalOverflowCallback callback)
+{
+    overflow_callback = callback;
+}
+
+HalMmwaveStatus hal_mmwave_borrow_frame(HalFrameView_t* view, uint32_t timeout_in_ms)
+{
+    if(view == NULL) {
+        return HAL_ERROR;
+    }
+    HalMmwaveStatus hs = hal_mmwave_get_frame_from_queue(&view->owned, timeout_in_ms);
+    if(hs != HAL_MMWAVE_OK) {
+        view->data = NULL;
+        view->len = 0;
+        return hs;
+    }
+    view->data = view->owned.data;
+    view->len = view->owned.len;
+    return HAL_MMWAVE_OK;
+}
+
+void hal_mmwave_return_frame(HalFrameView_t* view)
+{
+    if(view == NULL) {
+        return;
+    }
+    hal_free(view->owned.data, view->owned.len);
+    view->owned.data = NULL;
+    view->owned.len = 0;
+    view->data = NULL;
+    view->len = 0;
 }
\ No newline at end of file
@@ -31,7 +31,7 @@ static on_network_data network_data_cb = NULL;
 /**
  * @brief Handla podatke koje platform Web Socket primi preko Web Socketa.
  * 
- * @note TO-DO
+ * @note Podatci pripadaju Web Socket driveru i valjani su samo za vrijeme poziva - app sloj ih kopira.
  * 
  * @param data Pokazivač na primljene podatke
  * @param len Duljina primljenih podataka u bajtovima
@@ -43,7 +43,6 @@ static void hal_on_ws_data(const uint8_t* data, size_t len)
             network_data_cb(data, len);
         }
     }
-    platform_free(data); //free memorije rezervirane na platform sloju
 }
 
 /**
@@ -52,7 +52,7 @@ HalMmwaveStatus hal_mmwave_init(hal_mmwave_config* configuration, mmWave_core_in
 /**
  * @brief Pokreće HAL mmWave modul.
  * 
- * Funkcija resetira interne zastavice za taskove, pokreće ISR za UART, pokreće platform converter task,
+ * Funkcija resetira interne zastavice za taskove, pokreće ISR za UART, pokreće platform converter task (osim u direktnom načinu),
  * te pokreće sender i receiver taskove - efektivno započinje primanje, obradu i slanje frame-ova.
  * 
  * @return HAL_MMWAVE_OK ako je modul uspješno pokrenut, 
@@ -135,4 +135,52 @@ void hal_mmwave_release_frame_memory(FrameData_t* frame_data);
  * Funkcija na poziv u potpunosti prazni HAL-ov queue u kojem čuva parsirane frame-ove.
  * 
  */
-void hal_mmwave_flush_frames(void);
\ No newline at end of file
+void hal_mmwave_flush_frames(void);
+
+/**
+ * @brief Dohvaća statistiku trajanja parsiranja primljenih podataka u RX tasku.
+ * 
+ * Statistika se mjeri brojačem ciklusa oko poziva mmWave core parsera i briše se kod svakog pokretanja HAL-a.
+ * 
+ * @param stats Pokazivač na strukturu u koju se kopira statistika
+ * 
+ * @note Kopija se radi bez zaključavanja - pojedina polja mogu biti iz susjednih mjerenja.
+ */
+void hal_mmwave_get_parse_timing(PlatformTimingStats_t* stats);
+
+/**
+ * @brief Dohvaća trenutne RX postavke (threshold, timeout) i broj buđenja RX taska po frame-u.
+ * 
+ * Brojači se brišu kod svakog pokretanja HAL-a.
+ * 
+ * @param metrics Pokazivač na strukturu u koju se spremaju metrike
+ */
+void hal_mmwave_get_rx_metrics(HalRxMetrics_t* metrics);
+
+/**
+ * @brief Registrira callback koji se poziva nakon oporavka od preljeva na UART ulazu.
+ * 
+ * @param callback Pokazivač na callback funkciju (NULL za odjavu)
+ */
+void hal_mmwave_register_overflow_callback(HalOverflowCallback callback);
+
+/**
+ * @brief Posuđuje sljedeći frame iz queue-a bez kopiranja (blokirajuće do isteka timeouta).
+ * 
+ * Vlasništvo nad memorijom ostaje HAL-u - pozivatelj podatke samo čita i mora frame vratiti
+ * s hal_mmwave_return_frame().
+ * 
+ * @param view Pokazivač na pogled koji se popunjava
+ * @param timeout_in_ms Vrijeme čekanja u ms
+ * @return HAL_MMWAVE_OK ako je frame posuđen,
+ * @return HAL_ERROR ako frame nije dohvaćen (isteklo vrijeme ili view == NULL),
+ * @return HAL_MMWAVE_INVALID_STATE ako je HAL u stanju iz kojeg se ne smije dohvaćati frame
+ */
+HalMmwaveStatus hal_mmwave_borrow_frame(HalFrameView_t* view, uint32_t timeout_in_ms);
+
+/**
+ * @brief Vraća posuđeni frame HAL-u, koji oslobađa njegovu memoriju.
+ * 
+ * @param view Pokazivač na pogled dobiven s hal_mmwave_borrow_frame() - nakon poziva više nije valjan
+ */
+void hal_mmwave_return_frame(HalFrameView_t* view);
\ No newline at end of file
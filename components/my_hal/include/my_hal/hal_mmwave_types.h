@@ -19,6 +19,7 @@
 #pragma once
 #include "stdio.h"
 #include "stdint.h"
+#include "stdbool.h"
 #include "board.h"
 #include "platform/platform.h"
 
@@ -56,10 +57,50 @@ typedef struct {
     uint8_t stop_bits; /**< Broj stop bitova */
     size_t rx_buff_size; /**< Veličina RX buffera */
     size_t tx_buff_size; /**< Veličina TX buffera */
-    size_t rx_thresh; /**< RX threshold za generiranje UART_DATA eventa */
+    size_t rx_thresh; /**< RX threshold za generiranje UART_DATA eventa (početna vrijednost ako je rx_adaptive) */
+    uint8_t rx_timeout; /**< RX timeout u trajanju UART simbola (početna vrijednost ako je rx_adaptive) */
+    bool rx_adaptive; /**< true - HAL tijekom rada prilagođava RX threshold i RX timeout prometu */
+    bool frame_end_detection; /**< true - RX task se budi na završnom bajtu frame-a umjesto na threshold/timeout */
+    uint8_t frame_tail_byte; /**< Završni bajt frame-a za detekciju kraja frame-a (zadaje ga pozivatelj - HAL ne poznaje protokol) */
     size_t event_queue_len; /**< Veličina internog event queue */
+    bool direct_events; /**< true - RX task čeka direktno na UART eventima drivera (bez platform dispatcher taska) */
 } hal_mmwave_config;
 
+/**
+ * @struct HalRxMetrics_t
+ * @brief Trenutne RX postavke i omjer buđenja RX taska po frame-u.
+ * 
+ */
+typedef struct {
+    uint32_t rx_thresh; /**< Trenutni RX threshold u bajtovima */
+    uint32_t rx_timeout; /**< Trenutni RX timeout u trajanju UART simbola */
+    uint32_t wakeups; /**< Broj RX_DATA evenata (buđenja RX taska) od pokretanja */
+    uint32_t frames; /**< Broj parsiranih frame-ova od pokretanja */
+    uint32_t wakeups_per_frame_x100; /**< Broj buđenja po frame-u pomnožen sa 100 */
+    uint32_t fifo_overflows; /**< Broj preljeva hardverskog RX FIFO-a od pokretanja */
+    uint32_t buffer_full_events; /**< Broj popunjenja RX ring buffera drivera od pokretanja */
+} HalRxMetrics_t;
+
+/**
+ * @enum HalOverflowType
+ * @brief Vrste preljeva na UART ulazu nakon kojih HAL provodi oporavak.
+ * 
+ */
+typedef enum {
+    HAL_OVERFLOW_FIFO, /**< Preljev hardverskog RX FIFO-a */
+    HAL_OVERFLOW_BUFFER_FULL /**< Popunjen RX ring buffer drivera */
+} HalOverflowType;
+
+/**
+ * @brief Callback koji HAL poziva nakon oporavka od preljeva na UART ulazu.
+ * 
+ * Poziva se iz konteksta HAL RX taska - ne smije dugo blokirati.
+ * 
+ * @param type Vrsta preljeva
+ * @param count Ukupan broj preljeva te vrste od pokretanja HAL-a
+ */
+typedef void (*HalOverflowCallback)(HalOverflowType type, uint32_t count);
+
 /**
  * @enum HalMmwaveStatus
  * @brief Povratni statusi operacija nad HAL-om.
@@ -90,4 +131,17 @@ typedef enum {
  * @brief Tip podatka za pohranu mmWave frame-ova u queue na HAL sloju.
  * 
  */
-typedef QueueElement_t FrameData_t;
\ No newline at end of file
+typedef QueueElement_t FrameData_t;
+
+/**
+ * @struct HalFrameView_t
+ * @brief Posuđeni (read-only) pogled na frame u vlasništvu HAL-a.
+ * 
+ * Podatci se ne kopiraju - pogled vrijedi do poziva hal_mmwave_return_frame(), nakon čega HAL oslobađa memoriju.
+ * 
+ */
+typedef struct {
+    const uint8_t* data; /**< Semantički korisni podatci frame-a (samo za čitanje) */
+    size_t len; /**< Duljina podataka u bajtovima */
+    FrameData_t owned; /**< Interno - frame koji HAL oslobađa kod vraćanja */
+} HalFrameView_t;
\ No newline at end of file
@@ -17,6 +17,9 @@
 /**
  * @brief Pokazivač na funkciju koja se zove kada Web Socket primi podatke.
  * 
+ * Podatci pripadaju driveru i valjani su samo za vrijeme poziva - callback ih ne smije osloboditi, a
+ * ako su mu potrebni kasnije, mora ih kopirati.
+ * 
  * @param data Pokazivač na array bajtova koji predstavljaju primljene podatke
  * @param len Duljina arraya primljenih podataka
  */
@@ -18,6 +18,8 @@
 #include "esp_heap_caps.h"
 #include "platform/platform_memory.h"
 
+static volatile uint32_t alloc_count = 0; /**< Broj uspješnih alokacija od pokretanja sustava */
+
 MemoryOperationStatus platform_malloc(void** mem_location, uint32_t size)
 {
     if(size > MAX_MEMORY_SIZE) {
@@ -29,6 +31,7 @@ MemoryOperationStatus platform_malloc(void** mem_location, uint32_t size)
         return MEM_ERROR;
     } else {
         *mem_location = allocated_memory;
+        __atomic_fetch_add(&alloc_count, 1, __ATOMIC_RELAXED);
         return MEM_OK;
     }
 }
@@ -51,4 +54,9 @@ uint32_t get_min_free_heap(void)
 uint32_t get_largest_heap_block(void)
 {
     return heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+}
+
+uint32_t platform_get_alloc_count(void)
+{
+    return __atomic_load_n(&alloc_count, __ATOMIC_RELAXED);
 }
\ No newline at end of file
@@ -18,10 +18,19 @@
 #include "freertos/semphr.h"
 #include "platform/platform_mutex.h"
 
+_Static_assert(sizeof(StaticSemaphore_t) <= sizeof(PlatformStaticMutex_t), "PLATFORM_STATIC_MUTEX_SIZE premalen za StaticSemaphore_t");
+
 MutexHandle_t platform_create_mutex(void)
 {
     return xSemaphoreCreateMutex();
 }
+MutexHandle_t platform_create_mutex_static(PlatformStaticMutex_t* mutex_buffer)
+{
+    if(mutex_buffer == NULL) {
+        return NULL;
+    }
+    return xSemaphoreCreateMutexStatic((StaticSemaphore_t*)mutex_buffer);
+}
 MutexOperationStatus platform_lock_mutex(MutexHandle_t mutex, uint32_t timeout)
 {
     TickType_t time_to_wait;
@@ -6,6 +6,9 @@
  * Ovaj modul implementira funkcije za rad s queue-ovima na platform sloju. Modul je wrapper za
  * FreeRTOS queue API kako bi se omogućila apstrakcija i neovisnost ostatka sustava o platformi.
  * 
+ * Byte-ring queue implementiran je preko ESP-IDF ring buffera (no-split tip), koji podržava
+ * rezervaciju mjesta (SendAcquire/SendComplete) i dohvat zapisa bez kopiranja (Receive/ReturnItem).
+ * 
  * @note Sve timeout vrijednosti se automatski konvertiraju iz milisekundi u tickove koristeći
  * FreeRTOS pdMS_TO_TICKS makro.
  * 
@@ -19,13 +22,40 @@
 #include <stdio.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/queue.h"
+#include "freertos/ringbuf.h"
 #include "platform/platform_queue.h"
 
+_Static_assert(sizeof(StaticQueue_t) <= sizeof(PlatformStaticQueue_t), "PLATFORM_STATIC_QUEUE_CB_SIZE premalen za StaticQueue_t");
+_Static_assert(sizeof(StaticRingbuffer_t) <= sizeof(PlatformStaticRing_t), "PLATFORM_STATIC_RING_CB_SIZE premalen za StaticRingbuffer_t");
+
+/**
+ * @brief Pretvara timeout u ms u FreeRTOS tickove, uz podršku za beskonačno čekanje.
+ * 
+ * @param timeout_in_ms Vrijeme čekanja u ms
+ * @return Vrijeme čekanja u tickovima
+ */
+static TickType_t ring_timeout_to_ticks(uint32_t timeout_in_ms)
+{
+    if(timeout_in_ms == PLATFORM_RING_WAIT_FOREVER) {
+        return portMAX_DELAY;
+    }
+    return pdMS_TO_TICKS(timeout_in_ms);
+}
+
 PlatformQueueHandle platform_queue_create(size_t queue_length, size_t element_size)
 {
     return (PlatformQueueHandle) xQueueCreate(queue_length, element_size);
 }
 
+PlatformQueueHandle platform_queue_create_static(size_t queue_length, size_t element_size, uint8_t* storage,
+    PlatformStaticQueue_t* queue_buffer)
+{
+    if(storage == NULL || queue_buffer == NULL) {
+        return NULL;
+    }
+    return (PlatformQueueHandle) xQueueCreateStatic(queue_length, element_size, storage, (StaticQueue_t*)queue_buffer);
+}
+
 QueueOperationStatus platform_queue_send(PlatformQueueHandle queue, QueueElement_t* item, uint32_t timeout_in_ms)
 {
     if(xQueueSend((QueueHandle_t)queue, item, pdMS_TO_TICKS(timeout_in_ms)) == pdTRUE) {
@@ -68,4 +98,83 @@ QueueOperationStatus platform_queue_reset(PlatformQueueHandle queue)
     } else {
         return QUEUE_ERROR;
     }
+}
+
+PlatformRingHandle platform_ring_create(size_t size_in_bytes)
+{
+    return (PlatformRingHandle) xRingbufferCreate(size_in_bytes, RINGBUF_TYPE_NOSPLIT);
+}
+
+PlatformRingHandle platform_ring_create_static(size_t size_in_bytes, uint8_t* storage, PlatformStaticRing_t* ring_buffer)
+{
+    if(storage == NULL || ring_buffer == NULL) {
+        return NULL;
+    }
+    return (PlatformRingHandle) xRingbufferCreateStatic(size_in_bytes, RINGBUF_TYPE_NOSPLIT, storage,
+        (StaticRingbuffer_t*)ring_buffer);
+}
+
+/**
+ * @note Zapisi se primatelju predaju redoslijedom rezervacije - zapis rezerviran kasnije neće biti vidljiv
+ * dok se ne potvrde svi ranije rezervirani zapisi.
+ * 
+ */
+QueueOperationStatus platform_ring_reserve(PlatformRingHandle ring, void** item, size_t len, uint32_t timeout_in_ms)
+{
+    if(ring == NULL || item == NULL || len == 0) {
+        return QUEUE_ERROR;
+    }
+    if(xRingbufferSendAcquire((RingbufHandle_t)ring, item, len, ring_timeout_to_ticks(timeout_in_ms)) == pdTRUE) {
+        return QUEUE_OK;
+    } else {
+        *item = NULL;
+        return QUEUE_FULL;
+    }
+}
+
+QueueOperationStatus platform_ring_commit(PlatformRingHandle ring, void* item)
+{
+    if(ring == NULL || item == NULL) {
+        return QUEUE_ERROR;
+    }
+    if(xRingbufferSendComplete((RingbufHandle_t)ring, item) == pdTRUE) {
+        return QUEUE_OK;
+    } else {
+        return QUEUE_ERROR;
+    }
+}
+
+QueueOperationStatus platform_ring_peek(PlatformRingHandle ring, void** item, size_t* len, uint32_t timeout_in_ms)
+{
+    if(ring == NULL || item == NULL || len == NULL) {
+        return QUEUE_ERROR;
+    }
+    *item = xRingbufferReceive((RingbufHandle_t)ring, len, ring_timeout_to_ticks(timeout_in_ms));
+    if(*item == NULL) {
+        *len = 0;
+        return QUEUE_EMPTY;
+    }
+    return QUEUE_OK;
+}
+
+void platform_ring_release(PlatformRingHandle ring, void* item)
+{
+    if(ring != NULL && item != NULL) {
+        vRingbufferReturnItem((RingbufHandle_t)ring, item);
+    }
+}
+
+size_t platform_ring_get_free_size(PlatformRingHandle ring)
+{
+    if(ring == NULL) {
+        return 0;
+    }
+    return xRingbufferGetCurFreeSize((RingbufHandle_t)ring);
+}
+
+void platform_ring_delete(PlatformRingHandle ring)
+{
+    if(ring != NULL) {
+        vRingbufferDelete((RingbufHandle_t)ring);
+    }
 }
\ No newline at end of file
@@ -0,0 +1,99 @@
+/**
+ * @file esp32_signal.c
+ * @author Marko Fuček
+ * @brief ESP32 implementacija platform_signal API-ja.
+ * 
+ * Ovaj modul implementira grupe signalnih bitova preko FreeRTOS event groupa.
+ * 
+ * @note Sve timeout vrijednosti se automatski konvertiraju iz milisekundi u tickove koristeći
+ * FreeRTOS pdMS_TO_TICKS makro.
+ * 
+ * @version 0.1
+ * @date 2026-05-04
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+#include <stdio.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/event_groups.h"
+#include "platform/platform_signal.h"
+
+_Static_assert(sizeof(StaticEventGroup_t) <= sizeof(PlatformStaticSignal_t), "PLATFORM_STATIC_SIGNAL_SIZE premalen za StaticEventGroup_t");
+
+PlatformSignalHandle platform_signal_create(void)
+{
+    return (PlatformSignalHandle) xEventGroupCreate();
+}
+
+PlatformSignalHandle platform_signal_create_static(PlatformStaticSignal_t* signal_buffer)
+{
+    if(signal_buffer == NULL) {
+        return NULL;
+    }
+    return (PlatformSignalHandle) xEventGroupCreateStatic((StaticEventGroup_t*)signal_buffer);
+}
+
+void platform_signal_set(PlatformSignalHandle signal, PlatformSignalBits bits)
+{
+    if(signal != NULL) {
+        xEventGroupSetBits((EventGroupHandle_t)signal, bits);
+    }
+}
+
+/**
+ * @note FreeRTOS postavljanje bitova iz ISR-a odgađa na timer daemon task (bitove ne postavlja
+ * izravno u ISR-u), a po potrebi odmah predaje procesor tasku većeg prioriteta.
+ * 
+ */
+bool platform_signal_set_from_ISR(PlatformSignalHandle signal, PlatformSignalBits bits)
+{
+    if(signal == NULL) {
+        return false;
+    }
+    BaseType_t higher_woken = pdFALSE;
+    if(xEventGroupSetBitsFromISR((EventGroupHandle_t)signal, bits, &higher_woken) != pdPASS) {
+        return false;
+    }
+    portYIELD_FROM_ISR(higher_woken);
+    return true;
+}
+
+void platform_signal_clear(PlatformSignalHandle signal, PlatformSignalBits bits)
+{
+    if(signal != NULL) {
+        xEventGroupClearBits((EventGroupHandle_t)signal, bits);
+    }
+}
+
+PlatformSignalBits platform_signal_get(PlatformSignalHandle signal)
+{
+    if(signal == NULL) {
+        return 0;
+    }
+    return xEventGroupGetBits((EventGroupHandle_t)signal);
+}
+
+PlatformSignalBits platform_signal_wait(PlatformSignalHandle signal, PlatformSignalBits bits, bool wait_all,
+    bool clear_on_exit, uint32_t timeout_in_ms)
+{
+    if(signal == NULL || bits == 0) {
+        return 0;
+    }
+    TickType_t time_to_wait;
+    if(timeout_in_ms == PLATFORM_SIGNAL_WAIT_FOREVER) {
+        time_to_wait = portMAX_DELAY;
+    } else {
+        time_to_wait = pdMS_TO_TICKS(timeout_in_ms);
+    }
+    return xEventGroupWaitBits((EventGroupHandle_t)signal, bits, clear_on_exit ? pdTRUE : pdFALSE,
+        wait_all ? pdTRUE : pdFALSE, time_to_wait);
+}
+
+void platform_signal_delete(PlatformSignalHandle signal)
+{
+    if(signal != NULL) {
+        vEventGroupDelete((EventGroupHandle_t)signal);
+    }
+}
\ No newline at end of file
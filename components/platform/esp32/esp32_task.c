@@ -8,6 +8,8 @@
  * 
  * @note Sve timeout vrijednosti se automatski konvertiraju iz milisekundi u tickove koristeći
  * FreeRTOS pdMS_TO_TICKS makro.
+ * @note Taskovi se uvijek stvaraju preko PinnedToCore varijanti FreeRTOS funkcija, a afinitet
+ * PLATFORM_TASK_CORE_ANY se prevodi u tskNO_AFFINITY.
  * 
  * @version 0.1
  * @date 2026-01-29
@@ -21,11 +23,44 @@
 #include "freertos/task.h"
 #include "platform/platform_task.h"
 
+_Static_assert(sizeof(StaticTask_t) <= sizeof(PlatformStaticTask_t), "PLATFORM_STATIC_TASK_CB_SIZE premalen za StaticTask_t");
+
+/**
+ * @brief Pretvara platform afinitet taska u ESP-IDF oznaku jezgre.
+ * 
+ * @param core Afinitet iz konfiguracije taska
+ * @return Broj jezgre ili tskNO_AFFINITY (bez afiniteta ili jezgra ne postoji na ovom čipu)
+ */
+static BaseType_t task_core_to_esp32(PlatformTaskCore core)
+{
+    switch (core)
+    {
+    case PLATFORM_TASK_CORE_0:
+        return 0;
+    case PLATFORM_TASK_CORE_1:
+        return (portNUM_PROCESSORS > 1) ? 1 : tskNO_AFFINITY;
+    default:
+        return tskNO_AFFINITY;
+    }
+}
+
 task_handler platform_create_task(TaskConfig_t* taskConfig)
 {
     TaskHandle_t task_handle = NULL;
-    xTaskCreate(taskConfig->task_function, taskConfig->task_name, taskConfig->task_stack,
-         taskConfig->task_parameters, taskConfig->task_priority, &task_handle);
+    xTaskCreatePinnedToCore(taskConfig->task_function, taskConfig->task_name, taskConfig->task_stack,
+         taskConfig->task_parameters, taskConfig->task_priority, &task_handle,
+         task_core_to_esp32(taskConfig->task_core));
+    return (task_handler)task_handle;
+}
+
+task_handler platform_create_task_static(TaskConfig_t* taskConfig, void* stack_buffer, PlatformStaticTask_t* task_buffer)
+{
+    if(stack_buffer == NULL || task_buffer == NULL) {
+        return NULL;
+    }
+    TaskHandle_t task_handle = xTaskCreateStaticPinnedToCore(taskConfig->task_function, taskConfig->task_name,
+        taskConfig->task_stack, taskConfig->task_parameters, taskConfig->task_priority,
+        (StackType_t*)stack_buffer, (StaticTask_t*)task_buffer, task_core_to_esp32(taskConfig->task_core));
     return (task_handler)task_handle;
 }
 
@@ -34,6 +69,13 @@ void platform_delete_task(task_handler task_handler)
     vTaskDelete((TaskHandle_t)task_handler);
 }
 
+void platform_park_task(void)
+{
+    for(;;) {
+        vTaskSuspend(NULL);
+    }
+}
+
 void platform_delay_task(uint32_t ms_to_delay)
 {
     vTaskDelay(pdMS_TO_TICKS(ms_to_delay));
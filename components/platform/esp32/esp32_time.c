@@ -6,6 +6,8 @@
  * Ovaj modul implementira funkcije za dohvaćanje broja tickova i milisekundi od početka
  * rada procesora za ESP-IDF framework.
  * 
+ * Mikrosekundni sat temelji se na esp_timer-u, a brojač ciklusa na CCOUNT registru jezgre.
+ * 
  * @version 0.1
  * @date 2026-01-29
  * 
@@ -16,6 +18,9 @@
 #include <stdio.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "esp_timer.h"
+#include "esp_cpu.h"
+#include "esp_rom_sys.h"
 #include "platform/platform_time.h"
 
 uint32_t platform_getNumOfTicks(void)
@@ -26,4 +31,51 @@ uint32_t platform_getNumOfTicks(void)
 uint32_t platform_getNumOfMs(void)
 {
     return (xTaskGetTickCount() * portTICK_PERIOD_MS);
+}
+
+uint64_t platform_getNumOfUs(void)
+{
+    return (uint64_t)esp_timer_get_time();
+}
+
+uint32_t platform_get_cycle_count(void)
+{
+    return (uint32_t)esp_cpu_get_cycle_count();
+}
+
+uint32_t platform_cycles_to_ns(uint32_t cycles)
+{
+    return (uint32_t)(((uint64_t)cycles * 1000) / esp_rom_get_cpu_ticks_per_us());
+}
+
+void platform_timing_record(PlatformTimingStats_t* stats, uint32_t cycles)
+{
+    if(stats == NULL) {
+        return;
+    }
+    if(stats->count == 0 || cycles < stats->min_cycles) {
+        stats->min_cycles = cycles;
+    }
+    if(cycles > stats->max_cycles) {
+        stats->max_cycles = cycles;
+    }
+    stats->last_cycles = cycles;
+    stats->total_cycles += cycles;
+    stats->count++;
+}
+
+void platform_timing_scope_end(PlatformTimingScope_t* scope)
+{
+    platform_timing_record(scope->stats, platform_get_cycle_count() - scope->start_cycles);
+}
+
+void platform_timing_reset(PlatformTimingStats_t* stats)
+{
+    if(stats != NULL) {
+        stats->count = 0;
+        stats->last_cycles = 0;
+        stats->min_cycles = 0;
+        stats->max_cycles = 0;
+        stats->total_cycles = 0;
+    }
 }
\ No newline at end of file
@@ -0,0 +1,155 @@
+/**
+ * @file esp32_trace.c
+ * @author Marko Fuček
+ * @brief ESP32 implementacija platform_trace API-ja.
+ * 
+ * Svaka jezgra ima vlastiti ring zapisa. Mjesto u ringu rezervira se atomskim povećanjem brojača
+ * upisa, pa se task, ISR i task koji ga je prekinuo nikad ne natječu za isto mjesto. Vrijeme se
+ * uzima iz esp_timer-a, a naziv taska iz FreeRTOS-a.
+ * 
+ * @version 0.1
+ * @date 2026-05-11
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdatomic.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+#include "platform/platform_trace.h"
+
+_Static_assert(sizeof(PlatformTraceRecord_t) == 12, "PlatformTraceRecord_t mora imati 12 bajtova");
+_Static_assert((PLATFORM_TRACE_RING_LEN & (PLATFORM_TRACE_RING_LEN - 1)) == 0, "PLATFORM_TRACE_RING_LEN mora biti potencija broja 2");
+
+#if PLATFORM_TRACE_ENABLED
+/**
+ * @struct trace_ring_t
+ * @brief Ring zapisa jedne jezgre.
+ * 
+ */
+typedef struct {
+    PlatformTraceRecord_t records[PLATFORM_TRACE_RING_LEN]; /**< Zapisi */
+    atomic_uint written; /**< Ukupan broj rezerviranih mjesta (indeks sljedećeg upisa) */
+} trace_ring_t;
+
+static trace_ring_t trace_rings[portNUM_PROCESSORS];
+static atomic_bool trace_enabled = true;
+
+/**
+ * @brief Vraća broj valjanih zapisa u ringu.
+ * 
+ * @param ring Pokazivač na ring
+ * @return Broj zapisa (najviše PLATFORM_TRACE_RING_LEN)
+ */
+static size_t ring_count(trace_ring_t* ring)
+{
+    unsigned written = atomic_load(&ring->written);
+    return (written > PLATFORM_TRACE_RING_LEN) ? PLATFORM_TRACE_RING_LEN : written;
+}
+#endif
+
+void platform_trace_record(PlatformTraceEvent event, uint16_t arg)
+{
+#if PLATFORM_TRACE_ENABLED
+    if(!atomic_load_explicit(&trace_enabled, memory_order_relaxed)) {
+        return;
+    }
+    uint32_t core = xPortGetCoreID();
+    trace_ring_t* ring = &trace_rings[core];
+    unsigned slot = atomic_fetch_add_explicit(&ring->written, 1, memory_order_relaxed) & (PLATFORM_TRACE_RING_LEN - 1);
+
+    PlatformTraceRecord_t* rec = &ring->records[slot];
+    rec->timestamp_us = (uint32_t)esp_timer_get_time();
+    rec->core = (uint8_t)core;
+    rec->event = (uint8_t)event;
+    rec->arg = arg;
+    if(xPortInIsrContext()) {
+        memcpy(rec->task, "ISR", 4);
+    } else {
+        strncpy(rec->task, pcTaskGetName(NULL), PLATFORM_TRACE_TASK_NAME_LEN);
+    }
+#else
+    (void)event;
+    (void)arg;
+#endif
+}
+
+void platform_trace_set_enabled(bool enabled)
+{
+#if PLATFORM_TRACE_ENABLED
+    atomic_store(&trace_enabled, enabled);
+#else
+    (void)enabled;
+#endif
+}
+
+void platform_trace_clear(void)
+{
+#if PLATFORM_TRACE_ENABLED
+    for(int i = 0; i < portNUM_PROCESSORS; i++) {
+        atomic_store(&trace_rings[i].written, 0);
+    }
+#endif
+}
+
+size_t platform_trace_count(void)
+{
+    size_t count = 0;
+#if PLATFORM_TRACE_ENABLED
+    for(int i = 0; i < portNUM_PROCESSORS; i++) {
+        count += ring_count(&trace_rings[i]);
+    }
+#endif
+    return count;
+}
+
+size_t platform_trace_copy(size_t first, PlatformTraceRecord_t* out, size_t max)
+{
+    size_t copied = 0;
+#if PLATFORM_TRACE_ENABLED
+    if(out == NULL) {
+        return 0;
+    }
+    for(int i = 0; i < portNUM_PROCESSORS && copied < max; i++) {
+        trace_ring_t* ring = &trace_rings[i];
+        size_t count = ring_count(ring);
+        if(first >= count) {
+            first -= count;
+            continue;
+        }
+        //najstariji zapis je na mjestu written - count
+        unsigned oldest = atomic_load(&ring->written) - count;
+        for(size_t j = first; j < count && copied < max; j++) {
+            out[copied++] = ring->records[(oldest + j) & (PLATFORM_TRACE_RING_LEN - 1)];
+        }
+        first = 0;
+    }
+#else
+    (void)first;
+    (void)out;
+    (void)max;
+#endif
+    return copied;
+}
+
+void platform_trace_dump_console(void)
+{
+    platform_trace_set_enabled(false);
+    size_t count = platform_trace_count();
+    printf("TRACE_BEGIN,%u\n", (unsigned)count);
+    PlatformTraceRecord_t rec;
+    for(size_t i = 0; i < count; i++) {
+        if(platform_trace_copy(i, &rec, 1) != 1) {
+            break;
+        }
+        printf("TRACE,%lu,%u,%u,%u,%.*s\n", (unsigned long)rec.timestamp_us, rec.core, rec.event, rec.arg,
+            PLATFORM_TRACE_TASK_NAME_LEN, rec.task);
+    }
+    printf("TRACE_END\n");
+    platform_trace_clear();
+    platform_trace_set_enabled(true);
+}
\ No newline at end of file
@@ -13,6 +13,13 @@
  * Dispatcher funkciju za čekanje UART ISR generiranje eventova, njihovo prevođenje u platform i proslijeđivanje u queue.
  * Sigurno gašenje taska i onemogućivanje RX te TX pinova.
  * 
+ * Upravljanje dispatcher taskom (zahtjev za zaustavljanjem, zatvoreni RX, završetak rada) ide preko
+ * platform_signal grupe - dispatcher blokira na UART event queue-u, a za buđenje mu se u queue šalje
+ * prazan (wake) event.
+ * 
+ * U direktnom načinu (platform_uart_event_wait()) dispatcher se ne pokreće, a korisnik čeka direktno na
+ * UART event queue-u drivera i event se prevodi u njegovom kontekstu.
+ * 
  * @note Ova implementacija specifična je za ESP32 Wroom implementaciju.
  * @warning Funkcije nisu thread-safe.
  * 
@@ -30,17 +37,35 @@
 #include "freertos/queue.h"
 #include "platform/platform_uart.h"
 #include "platform/platform_events.h"
+#include "platform/platform_signal.h"
+#include "platform/platform_task.h"
 #include "my_hal/system_monitor.h"
 #include "board.h"
 #include "esp32_board.h"
 
-static bool volatile rx_closed = false;
 static QueueHandle_t uart_event_queue = NULL;
 static QueueHandle_t platform_event_queue = NULL;
-static TaskHandle_t dispatcher_task = NULL;
+static task_handler dispatcher_task = NULL;
+
+#define PLATFORM_EVENT_QUEUE_LEN 20 /**< Broj platform eventova koji stane u platform event queue */
+#define DISPATCHER_STACK_SIZE 12000 /**< Veličina stacka dispatcher taska u bajtovima */
+#define PATTERN_QUEUE_LEN 20 /**< Broj zapamćenih položaja kraja frame-a u driveru */
+
+#if PLATFORM_UART_DISPATCHER_ENABLED
+static uint8_t platform_event_queue_storage[PLATFORM_EVENT_QUEUE_LEN * sizeof(PlatformEvent_t)]; /**< Memorija platform event queue-a */
+static StaticQueue_t platform_event_queue_buffer; /**< Kontrolna struktura platform event queue-a */
+static uint8_t dispatcher_stack[DISPATCHER_STACK_SIZE]; /**< Statički stack dispatcher taska */
+static PlatformStaticTask_t dispatcher_tcb; /**< Statički kontrolni blok dispatcher taska */
+#endif
 
-bool volatile hal_dispatcher_ended_flag = false;
-bool volatile dispatcher_stop = false;
+#define DISPATCHER_STOP_BIT (1 << 0) /**< Zahtjev za zaustavljanjem dispatcher taska */
+#define DISPATCHER_RX_CLOSED_BIT (1 << 1) /**< RX interruptovi su onemogućeni */
+#define DISPATCHER_ENDED_BIT (1 << 2) /**< Dispatcher task nije pokrenut ili je završio s radom */
+
+static PlatformSignalHandle dispatcher_signal = NULL; /**< Signali za upravljanje dispatcher taskom */
+static PlatformStaticSignal_t dispatcher_signal_buffer;
+
+static volatile bool frame_end_enabled = false; /**< Uključena detekcija kraja frame-a - RX_DATA eventi se odbacuju */
 
 /**
  * @brief Mapira logički UART id na konkretne ESP32 UART pinove i UART broj.
@@ -110,6 +135,12 @@ static bool uart_event_to_platform_event(uart_event_t* uart_event, PlatformEvent
         platform_event->data = NULL;
         platform_event->len = uart_event->size;
         break;
+    case UART_PATTERN_DET:
+        //položaj se dohvaća tek kod čitanja (platform_uart_get_frame_end_len) - relativan je trenutnoj točki čitanja
+        platform_event->type = PLATFORM_EVENT_FRAME_END;
+        platform_event->data = NULL;
+        platform_event->len = 0;
+        break;
     default:
         platform_event->type = PLATFORM_EVENT_ERR;
         platform_event->data = NULL;
@@ -119,6 +150,24 @@ static bool uart_event_to_platform_event(uart_event_t* uart_event, PlatformEvent
     return true;
 }
 
+/**
+ * @brief Budi dispatcher task (ili direktnog čitatelja) koji blokira na UART event queue-u.
+ * 
+ * U queue se šalje event tipa UART_EVENT_MAX koji se kod konverzije odbacuje, a dispatcher
+ * nakon buđenja ponovno provjerava signale za zaustavljanje. Direktni čitatelj ga dobiva kao PLATFORM_EVENT_NONE.
+ * 
+ */
+static void dispatcher_wake(void)
+{
+    if(uart_event_queue != NULL) {
+        uart_event_t wake_event = {
+            .type = UART_EVENT_MAX,
+            .size = 0
+        };
+        xQueueSend(uart_event_queue, &wake_event, 0);
+    }
+}
+
 /**
  * @brief FreeRTOS task funkcija za konverziju UART ISR eventova u platform eventove.
  * 
@@ -132,37 +181,67 @@ static bool uart_event_to_platform_event(uart_event_t* uart_event, PlatformEvent
  * 
  * @warning Funkcija se izvršava u task kontekstu.
  */
+#if PLATFORM_UART_DISPATCHER_ENABLED
 static void dispatcher_function(void* arg)
 {
     uart_event_t uart_ev;
     PlatformEvent_t platform_ev;
-   for (;;) {
-        // Ako je postavljen stop flag od ISR-a ili izvana, te kad isprazniš queue, izađi
-        if ((platform_get_num_of_queue_elements(uart_event_queue) == 0) && (rx_closed || dispatcher_stop)) {
-            break;
-        }
-
-        // Blokiraj task dok ne dođe event ili dok ne trebamo stati
-        if (xQueueReceive(uart_event_queue, &uart_ev, pdMS_TO_TICKS(20)) == pdTRUE) {
+    for (;;) {
+        // Blokiraj task dok ne dođe event (ili wake event kod zaustavljanja)
+        if (xQueueReceive(uart_event_queue, &uart_ev, portMAX_DELAY) == pdTRUE) {
             //printf("[DISPATCHER] ISR uart_event type=%d, size=%d\n", uart_ev.type, uart_ev.size);
 
             // Pretvori UART event u platform event
             if(uart_event_to_platform_event(&uart_ev, &platform_ev)) {
-                // Ignoriraj ghost/none evente
+                // Ignoriraj ghost/none evente, te RX_DATA evente dok je uključena detekcija kraja frame-a
                 if (platform_ev.type != PLATFORM_EVENT_ERR &&
-                    platform_ev.type != PLATFORM_EVENT_NONE) {
+                    platform_ev.type != PLATFORM_EVENT_NONE &&
+                    !(frame_end_enabled && platform_ev.type == PLATFORM_EVENT_RX_DATA)) {
                     xQueueSend(platform_event_queue, &platform_ev, pdMS_TO_TICKS(20));
                 }
             }
         }
+
+        // Ako je RX zatvoren ili je zatražen stop, te kad isprazniš queue, izađi
+        if ((platform_get_num_of_queue_elements(uart_event_queue) == 0) &&
+            (platform_signal_get(dispatcher_signal) & (DISPATCHER_STOP_BIT | DISPATCHER_RX_CLOSED_BIT))) {
+            break;
+        }
     }
 
-    // Čišćenje i signal da je dispatcher završio, te samobrisanje taska na kraju
+    // Čišćenje, buđenje HAL-a praznim eventom i signal da je dispatcher završio - task briše dispatcher_reap()
     system_monitor_unregister_task(dispatcher_task);
-    hal_dispatcher_ended_flag = true;
+    PlatformEvent_t end_event = {
+        .type = PLATFORM_EVENT_NONE,
+        .data = NULL,
+        .len = 0
+    };
+    xQueueSend(platform_event_queue, &end_event, 0);
+    platform_signal_set(dispatcher_signal, DISPATCHER_ENDED_BIT);
+    platform_park_task();
+}
+
+/**
+ * @brief Briše dispatcher task koji je javio završetak.
+ * 
+ * Statički task ne briše sam sebe, pa se to radi ovdje - prije ponovnog korištenja njegovog stacka i
+ * kontrolnog bloka (start) ili gašenja drivera (deinit).
+ * 
+ * @return true ako dispatcher task više ne postoji, inače false (još radi)
+ */
+static bool dispatcher_reap(void)
+{
+    if(dispatcher_task == NULL) {
+        return true;
+    }
+    if(!(platform_signal_get(dispatcher_signal) & DISPATCHER_ENDED_BIT)) {
+        return false;
+    }
+    platform_delete_task(dispatcher_task);
     dispatcher_task = NULL;
-    vTaskDelete(NULL);
+    return true;
 }
+#endif
 
 UARTStatus platform_uart_set_rx_threshold(const BoardUartId id, uint32_t bytes) 
 {
@@ -174,8 +253,18 @@ UARTStatus platform_uart_set_rx_threshold(const BoardUartId id, uint32_t bytes)
     }
 }
 
+UARTStatus platform_uart_set_rx_timeout(const BoardUartId id, uint8_t symbols)
+{
+    esp32_uart_struct uart_numbers = find_uart(id);
+    if(uart_set_rx_timeout(uart_numbers.uart_num, symbols) == ESP_OK) {
+        return UART_OK;
+    } else {
+        return UART_ERROR;
+    }
+}
+
 /**
- * @note Funkcija stvara interni platform event queue i instalira ESP32 UART driver.
+ * @note Funkcija stvara interni platform event queue (u statičkoj memoriji modula) i instalira ESP32 UART driver.
  * 
  */
 UARTStatus platform_uart_init(const BoardUartId id, const platform_uart_config_t* uart_config)
@@ -185,10 +274,23 @@ UARTStatus platform_uart_init(const BoardUartId id, const platform_uart_config_t
         return UART_TIMEOUT;
     }
 
-    platform_event_queue = platform_create_event_queue(20);
+    if(dispatcher_signal == NULL) {
+        dispatcher_signal = platform_signal_create_static(&dispatcher_signal_buffer);
+        if(dispatcher_signal == NULL) {
+            return UART_ERROR;
+        }
+    }
+    //dispatcher još nije pokrenut
+    platform_signal_clear(dispatcher_signal, DISPATCHER_STOP_BIT | DISPATCHER_RX_CLOSED_BIT);
+    platform_signal_set(dispatcher_signal, DISPATCHER_ENDED_BIT);
+
+#if PLATFORM_UART_DISPATCHER_ENABLED
+    platform_event_queue = xQueueCreateStatic(PLATFORM_EVENT_QUEUE_LEN, sizeof(PlatformEvent_t),
+        platform_event_queue_storage, &platform_event_queue_buffer);
     if(platform_event_queue == NULL) {
         return UART_TIMEOUT;
     }
+#endif
 
     const uart_config_t config = {
         .baud_rate = uart_config->baudrate,
@@ -228,6 +330,24 @@ UARTStatus platform_uart_flush(const BoardUartId id)
     return UART_OK;
 }
 
+UARTStatus platform_uart_flush_input(const BoardUartId id)
+{
+    esp32_uart_struct uart_numbers = find_uart(id);
+    if(uart_flush_input(uart_numbers.uart_num) != ESP_OK) {
+        return UART_ERROR;
+    }
+    if(uart_event_queue != NULL) {
+        xQueueReset(uart_event_queue);
+    }
+    if(platform_event_queue != NULL) {
+        xQueueReset(platform_event_queue);
+    }
+    if(frame_end_enabled) {
+        uart_pattern_queue_reset(uart_numbers.uart_num, PATTERN_QUEUE_LEN);
+    }
+    return UART_OK;
+}
+
 uint32_t platform_uart_write(const BoardUartId id, uint8_t* data, size_t len)
 {
     esp32_uart_struct uart_numbers = find_uart(id);
@@ -241,13 +361,18 @@ uint32_t platform_uart_read(const BoardUartId id, uint8_t* buffer, int max_len,
 }
 
 /**
- * @note Funkcija stvara dispatcher task. Prije njegovog stvaranja nužno je očistiti RX buffer i
+ * @note Funkcija stvara dispatcher task sa statičkim stackom na jezgri senzorskog lanca. Prije njegovog stvaranja nužno je očistiti RX buffer i
  * uart_events ISR queue kako ne bi počeo čitati eventove koji su se u međuvremenu mogli dogoditi
- * (fresh start). U slučaju poziva kod postojanja dispatcher taska, vraća error.
+ * (fresh start). Dispatcher task koji je prethodno javio završetak ovdje se briše, a u slučaju poziva
+ * dok dispatcher task još radi, vraća error.
  */
 UARTStatus platform_uart_event_converter_start(const BoardUartId id)
 {
-    if(dispatcher_task != NULL) {
+#if !PLATFORM_UART_DISPATCHER_ENABLED
+    (void)id;
+    return UART_ERROR;
+#else
+    if(!dispatcher_reap()) {
         return UART_ERROR;
     }
     if(uart_event_queue == NULL || platform_event_queue == NULL) {
@@ -255,32 +380,150 @@ UARTStatus platform_uart_event_converter_start(const BoardUartId id)
     }
 
     esp32_uart_struct uart_numbers = find_uart(id);
-    dispatcher_stop = false;
-    hal_dispatcher_ended_flag = false;
+    platform_signal_clear(dispatcher_signal, DISPATCHER_STOP_BIT | DISPATCHER_ENDED_BIT);
 
     uart_flush(uart_numbers.uart_num);
     platform_queue_reset(uart_event_queue);
+    if(frame_end_enabled) {
+        uart_pattern_queue_reset(uart_numbers.uart_num, PATTERN_QUEUE_LEN);
+    }
     platform_event_queue_reset(platform_event_queue);
 
-    if(xTaskCreate(dispatcher_function, "dispatcher", 12000, NULL, 4, &dispatcher_task) == pdPASS) {
+    TaskConfig_t dispatcher_conf = {dispatcher_function, "dispatcher", DISPATCHER_STACK_SIZE, NULL, 4,
+        PLATFORM_TASK_CORE_SENSOR};
+    dispatcher_task = platform_create_task_static(&dispatcher_conf, dispatcher_stack, &dispatcher_tcb);
+    if(dispatcher_task != NULL) {
         system_monitor_register_task("dispatcher", dispatcher_task);
         return UART_OK;
     } else {
+        platform_signal_set(dispatcher_signal, DISPATCHER_ENDED_BIT);
         return UART_ERROR;
     }
+#endif
 }
 
 /**
- * @note Postavlja kontrolni flag koji javlja dispatcher tasku da odmah prestane s radom.
- * Koristi se kod poziva izvana, errora ili shutdowna/restarta sustava.
+ * @note Postavlja signal koji javlja dispatcher tasku da prestane s radom nakon pražnjenja queue-a,
+ * te ga budi wake eventom. Koristi se kod poziva izvana, errora ili shutdowna/restarta sustava.
+ * Bez pokrenutog dispatchera wake event budi pozivatelja platform_uart_event_wait() (direktni način).
  * 
  */
 void platform_uart_event_converter_stop(void)
 {
-    if(dispatcher_task != NULL) {
-        printf("[DISPATCHER] zavrsio s radom (hal_dispatcher_ended_flag = true)");
-        dispatcher_stop = true;
+    if(dispatcher_task != NULL && !platform_uart_event_converter_ended()) {
+        printf("[DISPATCHER] zaustavljanje\n");
+        platform_signal_set(dispatcher_signal, DISPATCHER_STOP_BIT);
     }
+    dispatcher_wake();
+}
+
+bool platform_uart_event_converter_ended(void)
+{
+    if(dispatcher_signal == NULL) {
+        return true;
+    }
+    return (platform_signal_get(dispatcher_signal) & DISPATCHER_ENDED_BIT) != 0;
+}
+
+UARTStatus platform_uart_event_converter_wait_ended(uint32_t timeout_in_ms)
+{
+    if(dispatcher_signal == NULL) {
+        return UART_OK;
+    }
+    PlatformSignalBits bits = platform_signal_wait(dispatcher_signal, DISPATCHER_ENDED_BIT, true, false, timeout_in_ms);
+    if(bits & DISPATCHER_ENDED_BIT) {
+        return UART_OK;
+    }
+    return UART_TIMEOUT;
+}
+
+/**
+ * @note Sentinel (wake) event tipa UART_EVENT_MAX vraća se kao PLATFORM_EVENT_NONE, a ostali eventi
+ * prevode se istom funkcijom kao u dispatcheru.
+ * 
+ */
+EventStatus platform_uart_event_wait(PlatformEvent_t* event, uint32_t timeout_in_ms)
+{
+    if(event == NULL || uart_event_queue == NULL) {
+        return PLATFORM_EVENT_ERROR;
+    }
+
+    uart_event_t uart_ev;
+    TickType_t start = xTaskGetTickCount();
+    TickType_t timeout = pdMS_TO_TICKS(timeout_in_ms);
+    for(;;) {
+        TickType_t elapsed = xTaskGetTickCount() - start;
+        if(elapsed > timeout) {
+            return PLATFORM_EVENT_TIMEOUT;
+        }
+        if(xQueueReceive(uart_event_queue, &uart_ev, timeout - elapsed) != pdTRUE) {
+            return PLATFORM_EVENT_TIMEOUT;
+        }
+        //dok je uključena detekcija kraja frame-a RX_DATA evente preskačemo i čekamo dalje
+        if(!(frame_end_enabled && uart_ev.type == UART_DATA)) {
+            break;
+        }
+    }
+
+    if(uart_ev.type == UART_EVENT_MAX) {
+        event->type = PLATFORM_EVENT_NONE;
+        event->data = NULL;
+        event->len = 0;
+        return PLATFORM_EVENT_OK;
+    }
+    uart_event_to_platform_event(&uart_ev, event);
+    return PLATFORM_EVENT_OK;
+}
+
+/**
+ * @note Detekcija je jedan znak bez uvjeta tišine prije i poslije (pre/post idle = 0), pa se kraj frame-a
+ * detektira i kad frame-ovi stižu jedan za drugim. RX timeout se gasi jer bi slao dodatni RX_DATA event po frame-u.
+ * 
+ */
+UARTStatus platform_uart_enable_frame_end_detection(const BoardUartId id, uint8_t tail_byte)
+{
+    esp32_uart_struct uart_numbers = find_uart(id);
+    if(uart_enable_pattern_det_baud_intr(uart_numbers.uart_num, (char)tail_byte, 1, 9, 0, 0) != ESP_OK) {
+        return UART_ERROR;
+    }
+    if(uart_pattern_queue_reset(uart_numbers.uart_num, PATTERN_QUEUE_LEN) != ESP_OK) {
+        uart_disable_pattern_det_intr(uart_numbers.uart_num);
+        return UART_ERROR;
+    }
+    uart_set_rx_timeout(uart_numbers.uart_num, 0);
+    frame_end_enabled = true;
+    return UART_OK;
+}
+
+UARTStatus platform_uart_disable_frame_end_detection(const BoardUartId id)
+{
+    esp32_uart_struct uart_numbers = find_uart(id);
+    frame_end_enabled = false;
+    if(uart_disable_pattern_det_intr(uart_numbers.uart_num) != ESP_OK) {
+        return UART_ERROR;
+    }
+    return UART_OK;
+}
+
+size_t platform_uart_get_frame_end_len(const BoardUartId id)
+{
+    esp32_uart_struct uart_numbers = find_uart(id);
+    int pos = uart_pattern_pop_pos(uart_numbers.uart_num);
+    if(pos >= 0) {
+        return (size_t)pos + 1;
+    }
+    //zapis o položaju je izgubljen - vraćamo sve primljeno, parser će se resinkronizirati
+    size_t buffered = 0;
+    uart_get_buffered_data_len(uart_numbers.uart_num, &buffered);
+    return buffered;
+}
+
+size_t platform_uart_get_num_of_pending_events(void)
+{
+    if(uart_event_queue == NULL) {
+        return 0;
+    }
+    return uxQueueMessagesWaiting(uart_event_queue);
 }
 
 UARTStatus platform_ISR_disable(const BoardUartId id) 
@@ -290,7 +533,8 @@ UARTStatus platform_ISR_disable(const BoardUartId id)
         return UART_ERROR;
     }
     printf("[UART DISABLE] stao s radom\n");
-    rx_closed = true;
+    platform_signal_set(dispatcher_signal, DISPATCHER_RX_CLOSED_BIT);
+    dispatcher_wake();
     return UART_OK;
 }
 
@@ -300,7 +544,7 @@ UARTStatus platform_ISR_enable(const BoardUartId id)
     if(uart_enable_rx_intr(uart_numbers.uart_num) != ESP_OK) {
         return UART_ERROR;
     }
-    rx_closed = false;
+    platform_signal_clear(dispatcher_signal, DISPATCHER_RX_CLOSED_BIT);
     return UART_OK;
 }
 
@@ -311,9 +555,11 @@ UARTStatus platform_ISR_enable(const BoardUartId id)
  */
 UARTStatus platform_uart_deinit(const BoardUartId id)
 {
-    if(dispatcher_task != NULL) {
+#if PLATFORM_UART_DISPATCHER_ENABLED
+    if(!dispatcher_reap()) {
         return UART_ERROR;
     }
+#endif
 
     esp32_uart_struct uart_numbers = find_uart(id);
 
@@ -324,6 +570,13 @@ UARTStatus platform_uart_deinit(const BoardUartId id)
         platform_event_queue = NULL;
     }
     
+    if(dispatcher_signal != NULL) {
+        platform_signal_delete(dispatcher_signal);
+        dispatcher_signal = NULL;
+    }
+
+    frame_end_enabled = false;
+
     //sad brišemo driver
     if(uart_driver_delete(uart_numbers.uart_num) != ESP_OK) {
         return UART_ERROR;
@@ -22,7 +22,6 @@
 #include "stdint.h"
 #include "freertos/FreeRTOS.h"
 #include "platform/websocket.h"
-#include "platform/platform_memory.h"
 #include "esp_websocket_client.h"
 #include "my_hal/hal_ws_interface.h"
 
@@ -64,16 +63,9 @@ static void ws_handler(void* arg, esp_event_base_t base, int32_t event_id, void*
         break;
     case WEBSOCKET_EVENT_DATA:
         esp_websocket_event_data_t* data_ = (esp_websocket_event_data_t*) event_data;
-        if((data_->data_len > 0) && (data_->data_ptr != NULL)) {
-            uint8_t* copy = NULL;
-            MemoryOperationStatus status = platform_malloc(&copy, data_->data_len);
-            if(status == MEM_OK) {
-                memcpy(copy, data_->data_ptr, data_->data_len);
-                if(hal_on_data_cb) {
-                    hal_on_data_cb(copy, data_->data_len);
-                    //HAL RADI FREE NAKON SLANJA!
-                }
-            }
+        //podatci drivera prosljeđuju se bez kopiranja - valjani su samo za vrijeme poziva callbacka
+        if((data_->data_len > 0) && (data_->data_ptr != NULL) && hal_on_data_cb) {
+            hal_on_data_cb((const uint8_t*)data_->data_ptr, data_->data_len);
         }
         break;
     case WEBSOCKET_EVENT_CLOSED:
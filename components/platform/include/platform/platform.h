@@ -21,4 +21,6 @@
 #include "platform_events.h"
 #include "wifi_client.h"
 #include "platform_mutex.h"
+#include "platform_signal.h"
+#include "platform_trace.h"
 #include "websocket.h"
\ No newline at end of file
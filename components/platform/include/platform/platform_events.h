@@ -41,7 +41,8 @@ typedef enum {
     PLATFORM_EVENT_TX_DONE, /**< Završeno slanje podataka */
     PLATFORM_EVENT_ERR, /**< Greška */
     PLATFORM_EVENT_FIFO_OVF, /**< Overflow event queue-a */
-    PLATFORM_EVENT_BUFFER_FULL /**< Ring buffer popunjen */
+    PLATFORM_EVENT_BUFFER_FULL, /**< Ring buffer popunjen */
+    PLATFORM_EVENT_FRAME_END /**< Primljen završni bajt frame-a (detekcija kraja frame-a) */
 } PlatformEvent_type;
 
 /**
@@ -74,4 +74,13 @@ uint32_t get_min_free_heap(void);
  * 
  * @return Veličina slobodnog heapa sustava u bajtovima
  */
-uint32_t get_largest_heap_block(void);
\ No newline at end of file
+uint32_t get_largest_heap_block(void);
+
+/**
+ * @brief Vraća ukupan broj uspješnih alokacija preko platform_malloc od pokretanja sustava.
+ * 
+ * Koristi se za mjerenje broja alokacija po obrađenom podatku (razlika dvaju očitanja).
+ * 
+ * @return Broj uspješnih alokacija
+ */
+uint32_t platform_get_alloc_count(void);
\ No newline at end of file
@@ -26,6 +26,24 @@
  */
 typedef void* MutexHandle_t;
 
+/**
+ * @brief Veličina memorije (u bajtovima) rezervirane za statički stvoreni mutex.
+ * 
+ * @note Platform implementacija pri prevođenju provjerava da njezin mutex stane u ovu veličinu.
+ */
+#define PLATFORM_STATIC_MUTEX_SIZE 128
+
+/**
+ * @struct PlatformStaticMutex_t
+ * @brief Memorija za statički stvoreni mutex.
+ * 
+ * Sadržaj strukture je neproziran - koristi ga isključivo platform implementacija.
+ * 
+ */
+typedef struct {
+    uint64_t storage[PLATFORM_STATIC_MUTEX_SIZE / sizeof(uint64_t)]; /**< Memorija mutexa */
+} PlatformStaticMutex_t;
+
 /**
  * @enum MutexOperationStatus
  * @brief Status operacije nad mutexom.
@@ -43,6 +61,16 @@ typedef enum {
  */
 MutexHandle_t platform_create_mutex(void);
 
+/**
+ * @brief Stvara mutex objekt bez alokacije na heapu.
+ * 
+ * @param mutex_buffer Memorija za mutex koju osigurava pozivatelj
+ * @return Pokazivač na mutex ili NULL (kod neuspješnog stvaranja)
+ * 
+ * @note Mutex se briše s platform_delete_mutex(), a memorija ostaje u vlasništvu pozivatelja.
+ */
+MutexHandle_t platform_create_mutex_static(PlatformStaticMutex_t* mutex_buffer);
+
 /**
  * @brief Zauzima mutex.
  * 
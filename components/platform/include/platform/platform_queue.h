@@ -48,6 +48,59 @@ typedef struct {
  */
  typedef void* PlatformQueueHandle;
 
+/**
+ * @brief Veličina memorije (u bajtovima) rezervirane za kontrolnu strukturu statički stvorenog queue-a.
+ * 
+ * @note Platform implementacija pri prevođenju provjerava da njezina struktura stane u ovu veličinu.
+ */
+#define PLATFORM_STATIC_QUEUE_CB_SIZE 128
+
+/**
+ * @struct PlatformStaticQueue_t
+ * @brief Memorija za kontrolnu strukturu statički stvorenog queue-a.
+ * 
+ * Sadržaj strukture je neproziran - koristi ga isključivo platform implementacija.
+ * 
+ */
+typedef struct {
+    uint64_t storage[PLATFORM_STATIC_QUEUE_CB_SIZE / sizeof(uint64_t)]; /**< Memorija kontrolne strukture */
+} PlatformStaticQueue_t;
+
+/**
+ * @typedef PlatformRingHandle
+ * @brief Pokazivač (handle) na platform byte-ring queue.
+ * 
+ * Byte-ring queue sprema zapise varijabilne duljine izravno u svoju memoriju. Pošiljatelj rezervira mjesto
+ * (reserve), upiše podatke na dobiveni pokazivač i potvrdi zapis (commit). Primatelj dobiva pokazivač na zapis
+ * u ringu (peek) i nakon obrade ga vraća (release). Podatci se kopiraju jednom i bez alokacije na heapu.
+ * 
+ */
+typedef void* PlatformRingHandle;
+
+/**
+ * @brief Vrijednost timeouta (u ms) za beskonačno čekanje kod byte-ring queue operacija.
+ * 
+ */
+#define PLATFORM_RING_WAIT_FOREVER UINT32_MAX
+
+/**
+ * @brief Veličina memorije (u bajtovima) rezervirane za kontrolnu strukturu statički stvorenog byte-ring queue-a.
+ * 
+ * @note Platform implementacija pri prevođenju provjerava da njezina struktura stane u ovu veličinu.
+ */
+#define PLATFORM_STATIC_RING_CB_SIZE 256
+
+/**
+ * @struct PlatformStaticRing_t
+ * @brief Memorija za kontrolnu strukturu statički stvorenog byte-ring queue-a.
+ * 
+ * Sadržaj strukture je neproziran - koristi ga isključivo platform implementacija.
+ * 
+ */
+typedef struct {
+    uint64_t storage[PLATFORM_STATIC_RING_CB_SIZE / sizeof(uint64_t)]; /**< Memorija kontrolne strukture */
+} PlatformStaticRing_t;
+
 /**
  * @brief Kreira queue.
  * 
@@ -57,6 +110,22 @@ typedef struct {
  */
 PlatformQueueHandle platform_queue_create(size_t queue_length, size_t element_size);
 
+/**
+ * @brief Kreira queue bez alokacije na heapu.
+ * 
+ * Memoriju za elemente i kontrolnu strukturu queue-a osigurava pozivatelj.
+ * 
+ * @param queue_length Maksimalan broj elemenata queue-a koje može spremiti
+ * @param element_size Veličina jednog queue elementa u bajtovima
+ * @param storage Memorija za elemente, veličine barem queue_length * element_size bajtova
+ * @param queue_buffer Memorija za kontrolnu strukturu queue-a
+ * @return Pokazivač na queue ili NULL (kod neuspješnog stvaranja)
+ * 
+ * @note Queue se briše s platform_queue_delete(), a memorija ostaje u vlasništvu pozivatelja.
+ */
+PlatformQueueHandle platform_queue_create_static(size_t queue_length, size_t element_size, uint8_t* storage,
+    PlatformStaticQueue_t* queue_buffer);
+
 /**
  * @brief Šalje element u queue.
  * 
@@ -98,4 +167,88 @@ uint32_t platform_get_num_of_queue_elements(PlatformQueueHandle queue);
  * @param queue Pokazivač na queue
  * @return Status operacije
  */
-QueueOperationStatus platform_queue_reset(PlatformQueueHandle queue);
\ No newline at end of file
+QueueOperationStatus platform_queue_reset(PlatformQueueHandle queue);
+
+/**
+ * @brief Kreira byte-ring queue za zapise varijabilne duljine.
+ * 
+ * @param size_in_bytes Ukupna veličina ringa u bajtovima (uključuje i interna zaglavlja zapisa)
+ * @return Pokazivač na byte-ring queue ili NULL (kod neuspješnog stvaranja)
+ */
+PlatformRingHandle platform_ring_create(size_t size_in_bytes);
+
+/**
+ * @brief Kreira byte-ring queue bez alokacije na heapu.
+ * 
+ * @param size_in_bytes Ukupna veličina ringa u bajtovima (višekratnik 4)
+ * @param storage Memorija ringa, veličine barem size_in_bytes bajtova
+ * @param ring_buffer Memorija za kontrolnu strukturu ringa
+ * @return Pokazivač na byte-ring queue ili NULL (kod neuspješnog stvaranja)
+ * 
+ * @note Ring se briše s platform_ring_delete(), a memorija ostaje u vlasništvu pozivatelja.
+ */
+PlatformRingHandle platform_ring_create_static(size_t size_in_bytes, uint8_t* storage, PlatformStaticRing_t* ring_buffer);
+
+/**
+ * @brief Rezervira mjesto za novi zapis u byte-ring queue-u.
+ * 
+ * Pozivatelj upisuje podatke izravno na dobiveni pokazivač, a zapis postaje vidljiv primatelju
+ * tek nakon poziva platform_ring_commit().
+ * 
+ * @param ring Pokazivač na byte-ring queue
+ * @param item Pokazivač na koji se sprema adresa rezerviranog mjesta
+ * @param len Duljina zapisa u bajtovima
+ * @param timeout_in_ms Vrijeme čekanja na slobodno mjesto u ms (PLATFORM_RING_WAIT_FOREVER za beskonačno)
+ * @return QUEUE_OK ako je mjesto rezervirano, QUEUE_FULL ako nema mjesta do isteka timeouta,
+ * QUEUE_ERROR kod neispravnih argumenata
+ */
+QueueOperationStatus platform_ring_reserve(PlatformRingHandle ring, void** item, size_t len, uint32_t timeout_in_ms);
+
+/**
+ * @brief Potvrđuje zapis prethodno rezerviran s platform_ring_reserve().
+ * 
+ * @param ring Pokazivač na byte-ring queue
+ * @param item Pokazivač na rezervirano mjesto
+ * @return Status operacije
+ */
+QueueOperationStatus platform_ring_commit(PlatformRingHandle ring, void* item);
+
+/**
+ * @brief Dohvaća pokazivač na najstariji potvrđeni zapis bez kopiranja.
+ * 
+ * Zapis ostaje u memoriji ringa sve dok ga pozivatelj ne vrati s platform_ring_release().
+ * 
+ * @param ring Pokazivač na byte-ring queue
+ * @param item Pokazivač na koji se sprema adresa zapisa
+ * @param len Pokazivač na koji se sprema duljina zapisa u bajtovima
+ * @param timeout_in_ms Vrijeme čekanja na zapis u ms (PLATFORM_RING_WAIT_FOREVER za beskonačno)
+ * @return QUEUE_OK ako je zapis dohvaćen, QUEUE_EMPTY ako zapisa nema do isteka timeouta,
+ * QUEUE_ERROR kod neispravnih argumenata
+ */
+QueueOperationStatus platform_ring_peek(PlatformRingHandle ring, void** item, size_t* len, uint32_t timeout_in_ms);
+
+/**
+ * @brief Vraća zapis dohvaćen s platform_ring_peek() i oslobađa njegovo mjesto u ringu.
+ * 
+ * @param ring Pokazivač na byte-ring queue
+ * @param item Pokazivač na zapis
+ */
+void platform_ring_release(PlatformRingHandle ring, void* item);
+
+/**
+ * @brief Vraća trenutno slobodno mjesto u byte-ring queue-u.
+ * 
+ * @param ring Pokazivač na byte-ring queue
+ * @return Najveća duljina zapisa u bajtovima koja se trenutno može rezervirati
+ */
+size_t platform_ring_get_free_size(PlatformRingHandle ring);
+
+/**
+ * @brief Briše byte-ring queue i oslobađa resurse.
+ * 
+ * @param ring Pokazivač na byte-ring queue
+ * 
+ * @warning Pozivatelj mora garantirati da niti jedan task više ne koristi ring, te da su svi
+ * dohvaćeni zapisi vraćeni.
+ */
+void platform_ring_delete(PlatformRingHandle ring);
\ No newline at end of file
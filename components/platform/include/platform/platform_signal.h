@@ -0,0 +1,137 @@
+/**
+ * @file platform_signal.h
+ * @author Marko Fuček
+ * @brief Platform API za signalizaciju između taskova.
+ * 
+ * Ovaj modul pruža grupu signalnih bitova preko koje taskovi (i ISR) jedni drugima javljaju događaje
+ * (zahtjev za zaustavljanjem, završetak rada taska, spremnost resursa...). Task koji čeka na signal
+ * je blokiran sve dok se traženi bitovi ne postave ili ne istekne timeout, umjesto da u petlji
+ * provjerava zastavicu.
+ * 
+ * @version 0.1
+ * @date 2026-05-04
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+#pragma once
+#include "stdio.h"
+#include "stdint.h"
+#include "stdbool.h"
+
+/**
+ * @brief Vrijednost timeouta (u ms) za beskonačno čekanje na signal.
+ * 
+ */
+#define PLATFORM_SIGNAL_WAIT_FOREVER UINT32_MAX
+
+/**
+ * @brief Broj signalnih bitova koje jedna grupa podržava (bitovi 0 - 23).
+ * 
+ */
+#define PLATFORM_SIGNAL_MAX_BITS 24
+
+/**
+ * @typedef PlatformSignalHandle
+ * @brief Pokazivač (handle) na grupu signalnih bitova.
+ * 
+ */
+typedef void* PlatformSignalHandle;
+
+/**
+ * @typedef PlatformSignalBits
+ * @brief Maska signalnih bitova.
+ * 
+ */
+typedef uint32_t PlatformSignalBits;
+
+/**
+ * @brief Veličina memorije (u bajtovima) rezervirane za statički stvorenu grupu signala.
+ * 
+ * @note Platform implementacija pri prevođenju provjerava da njezina struktura stane u ovu veličinu.
+ */
+#define PLATFORM_STATIC_SIGNAL_SIZE 64
+
+/**
+ * @struct PlatformStaticSignal_t
+ * @brief Memorija za statički stvorenu grupu signala.
+ * 
+ * Sadržaj strukture je neproziran - koristi ga isključivo platform implementacija.
+ * 
+ */
+typedef struct {
+    uint64_t storage[PLATFORM_STATIC_SIGNAL_SIZE / sizeof(uint64_t)]; /**< Memorija grupe signala */
+} PlatformStaticSignal_t;
+
+/**
+ * @brief Stvara grupu signalnih bitova (svi bitovi obrisani).
+ * 
+ * @return Pokazivač na grupu signala ili NULL (kod neuspješnog stvaranja)
+ */
+PlatformSignalHandle platform_signal_create(void);
+
+/**
+ * @brief Stvara grupu signalnih bitova bez alokacije na heapu.
+ * 
+ * @param signal_buffer Memorija za grupu signala koju osigurava pozivatelj
+ * @return Pokazivač na grupu signala ili NULL (kod neuspješnog stvaranja)
+ */
+PlatformSignalHandle platform_signal_create_static(PlatformStaticSignal_t* signal_buffer);
+
+/**
+ * @brief Postavlja signalne bitove i budi taskove koji na njih čekaju.
+ * 
+ * @param signal Pokazivač na grupu signala
+ * @param bits Maska bitova koji se postavljaju
+ */
+void platform_signal_set(PlatformSignalHandle signal, PlatformSignalBits bits);
+
+/**
+ * @brief Postavlja signalne bitove iz ISR konteksta.
+ * 
+ * @param signal Pokazivač na grupu signala
+ * @param bits Maska bitova koji se postavljaju
+ * @return true ako je zahtjev za postavljanjem uspješno predan
+ * @return false ako zahtjev nije predan
+ */
+bool platform_signal_set_from_ISR(PlatformSignalHandle signal, PlatformSignalBits bits);
+
+/**
+ * @brief Briše signalne bitove.
+ * 
+ * @param signal Pokazivač na grupu signala
+ * @param bits Maska bitova koji se brišu
+ */
+void platform_signal_clear(PlatformSignalHandle signal, PlatformSignalBits bits);
+
+/**
+ * @brief Dohvaća trenutno stanje signalnih bitova (ne blokira).
+ * 
+ * @param signal Pokazivač na grupu signala
+ * @return Trenutno postavljeni bitovi
+ */
+PlatformSignalBits platform_signal_get(PlatformSignalHandle signal);
+
+/**
+ * @brief Čeka (blokirajuće) na postavljanje signalnih bitova.
+ * 
+ * @param signal Pokazivač na grupu signala
+ * @param bits Maska bitova na koje se čeka
+ * @param wait_all true - čeka se da svi bitovi iz maske budu postavljeni, false - dovoljan je bilo koji
+ * @param clear_on_exit true - bitovi iz maske se brišu kada je uvjet čekanja ispunjen
+ * @param timeout_in_ms Vrijeme čekanja u ms (PLATFORM_SIGNAL_WAIT_FOREVER za beskonačno)
+ * @return Bitovi postavljeni u trenutku buđenja (prije brisanja) - pozivatelj iz njih provjerava
+ * je li uvjet ispunjen ili je istekao timeout
+ */
+PlatformSignalBits platform_signal_wait(PlatformSignalHandle signal, PlatformSignalBits bits, bool wait_all,
+    bool clear_on_exit, uint32_t timeout_in_ms);
+
+/**
+ * @brief Briše grupu signala i oslobađa resurse.
+ * 
+ * @param signal Pokazivač na grupu signala
+ * 
+ * @warning Pozivatelj mora garantirati da niti jedan task više ne čeka na grupu signala.
+ */
+void platform_signal_delete(PlatformSignalHandle signal);
\ No newline at end of file
@@ -31,6 +31,41 @@ typedef void (*task_function)(void*);
  */
 typedef void* task_handler;
 
+/**
+ * @enum PlatformTaskCore
+ * @brief Afinitet taska prema jezgri procesora.
+ * 
+ * @note Vrijednost 0 znači "bez afiniteta", pa konfiguracije koje polje ne postave zadržavaju
+ * dosadašnje ponašanje. Na jednojezgrenim platformama svaki afinitet se tretira kao PLATFORM_TASK_CORE_ANY.
+ */
+typedef enum {
+    PLATFORM_TASK_CORE_ANY = 0, /**< Scheduler sam bira jezgru */
+    PLATFORM_TASK_CORE_0, /**< Task je vezan za jezgru 0 */
+    PLATFORM_TASK_CORE_1 /**< Task je vezan za jezgru 1 */
+} PlatformTaskCore;
+
+/**
+ * @brief Zadana jezgra za senzorski lanac (UART dispatcher, HAL RX/TX task, decoder task).
+ * 
+ * Senzorski i mrežni taskovi su razdvojeni na različite jezgre kako Wi-Fi i websocket obrada ne bi
+ * kasnila s parsiranjem UART podataka. Na ESP32 Wi-Fi stack (i lwIP) po defaultu radi na jezgri 0,
+ * pa senzorski lanac ide na jezgru 1.
+ * 
+ * @note Može se pregaziti definicijom prije includanja ovog headera (npr. iz build sustava).
+ */
+#ifndef PLATFORM_TASK_CORE_SENSOR
+#define PLATFORM_TASK_CORE_SENSOR PLATFORM_TASK_CORE_1
+#endif
+
+/**
+ * @brief Zadana jezgra za mrežne taskove (slanje paketa, obrada poruka sa servera).
+ * 
+ * @note Može se pregaziti definicijom prije includanja ovog headera (npr. iz build sustava).
+ */
+#ifndef PLATFORM_TASK_CORE_NETWORK
+#define PLATFORM_TASK_CORE_NETWORK PLATFORM_TASK_CORE_0
+#endif
+
 /**
  * @struct TaskConfig_t
  * @brief Konfiguracija taska.
@@ -44,8 +79,28 @@ typedef struct {
     uint32_t task_stack;
     void* task_parameters;
     uint32_t task_priority;
+    PlatformTaskCore task_core; /**< Afinitet prema jezgri (PLATFORM_TASK_CORE_ANY ako nije zadan) */
 } TaskConfig_t;
 
+/**
+ * @brief Veličina memorije (u bajtovima) rezervirane za kontrolni blok statički stvorenog taska.
+ * 
+ * @note Platform implementacija pri prevođenju provjerava da njezin kontrolni blok stane u ovu veličinu.
+ * Veličina uključuje rezervu za ESP-IDF buildove s uključenim newlib reentrancy poljima u kontrolnom bloku.
+ */
+#define PLATFORM_STATIC_TASK_CB_SIZE 768
+
+/**
+ * @struct PlatformStaticTask_t
+ * @brief Memorija za kontrolni blok statički stvorenog taska.
+ * 
+ * Sadržaj strukture je neproziran - koristi ga isključivo platform implementacija.
+ * 
+ */
+typedef struct {
+    uint64_t storage[PLATFORM_STATIC_TASK_CB_SIZE / sizeof(uint64_t)]; /**< Memorija kontrolnog bloka */
+} PlatformStaticTask_t;
+
 /**
  * @brief Kreira novi task.
  * 
@@ -54,6 +109,22 @@ typedef struct {
  */
 task_handler platform_create_task(TaskConfig_t* taskConfig);
 
+/**
+ * @brief Kreira novi task bez alokacije na heapu.
+ * 
+ * Stack i kontrolni blok taska osigurava pozivatelj (najčešće kao statičke varijable modula).
+ * 
+ * @param taskConfig Pokazivač na konfiguraciju taska
+ * @param stack_buffer Memorija za stack taska, veličine barem taskConfig->task_stack bajtova
+ * @param task_buffer Memorija za kontrolni blok taska
+ * @return Pokazivač na task ili NULL (kod neuspješnog stvaranja)
+ * 
+ * @warning Memorija mora biti valjana cijelo vrijeme života taska i ne smije se ponovno koristiti
+ * dok task nije obrisan. Statički task ne smije obrisati sam sebe (njegov kontrolni blok tada ostaje u
+ * kernelu do idle taska) - javlja završetak i poziva platform_park_task(), a briše ga onaj tko ga zaustavlja.
+ */
+task_handler platform_create_task_static(TaskConfig_t* taskConfig, void* stack_buffer, PlatformStaticTask_t* task_buffer);
+
 /**
  * @brief Briše task.
  * 
@@ -61,6 +132,14 @@ task_handler platform_create_task(TaskConfig_t* taskConfig);
  */
 void platform_delete_task(task_handler task_handler);
 
+/**
+ * @brief Trajno blokira pozivajući task.
+ * 
+ * Koriste ga statički stvoreni taskovi nakon što jave završetak rada, kako bi ih pozivatelj mogao
+ * obrisati s platform_delete_task() prije ponovnog korištenja njihove memorije.
+ */
+void platform_park_task(void);
+
 /**
  * @brief Pauzira izvršavanje pozivajućeg taska.
  * 
@@ -6,6 +6,9 @@
  * Ovaj modul pruža API za dohat broja sistemskih tickova i mjerenje
  * vremena izvođenja taskova.
  * 
+ * Za mjerenje kratkih (vrućih) dijelova koda modul nudi 64-bitni monotoni sat u mikrosekundama,
+ * čitanje brojača ciklusa procesora i pomoćne makroe za mjerenje vremena izvođenja bloka koda.
+ * 
  * @version 0.1
  * @date 2026-01-20
  * 
@@ -30,4 +33,117 @@ uint32_t platform_getNumOfTicks(void);
  * 
  * @return Broj milisekundi (uint32_t)
  */
-uint32_t platform_getNumOfMs(void);
\ No newline at end of file
+uint32_t platform_getNumOfMs(void);
+
+/**
+ * @brief Dohvaća broj mikrosekundi od pokretanja sustava.
+ * 
+ * Sat je monoton i 64-bitni, pa se u praksi ne prelijeva.
+ * 
+ * @return Broj mikrosekundi (uint64_t)
+ */
+uint64_t platform_getNumOfUs(void);
+
+/**
+ * @brief Dohvaća trenutnu vrijednost brojača ciklusa procesora (jezgre na kojoj se task izvršava).
+ * 
+ * @note Brojač je 32-bitni i prelijeva se nakon nekoliko sekundi - koristi se isključivo za mjerenje
+ * kratkih intervala na istoj jezgri.
+ * 
+ * @return Broj ciklusa procesora (uint32_t)
+ */
+uint32_t platform_get_cycle_count(void);
+
+/**
+ * @brief Pretvara broj ciklusa procesora u nanosekunde.
+ * 
+ * @param cycles Broj ciklusa procesora
+ * @return Trajanje u nanosekundama
+ */
+uint32_t platform_cycles_to_ns(uint32_t cycles);
+
+/**
+ * @brief Uključuje (1) ili isključuje (0) makroe za mjerenje vremena izvođenja.
+ * 
+ * @note Kada je isključeno, makroi se prevode u prazne naredbe i nemaju nikakav trošak.
+ */
+#ifndef PLATFORM_TIMING_ENABLED
+#define PLATFORM_TIMING_ENABLED 1
+#endif
+
+/**
+ * @struct PlatformTimingStats_t
+ * @brief Statistika vremena izvođenja mjerenog dijela koda (u ciklusima procesora).
+ * 
+ * @note Jednu strukturu smije ažurirati samo jedan task.
+ */
+typedef struct {
+    uint32_t count; /**< Broj mjerenja */
+    uint32_t last_cycles; /**< Trajanje zadnjeg mjerenja */
+    uint32_t min_cycles; /**< Najkraće mjerenje */
+    uint32_t max_cycles; /**< Najdulje mjerenje */
+    uint64_t total_cycles; /**< Zbroj svih mjerenja */
+} PlatformTimingStats_t;
+
+/**
+ * @struct PlatformTimingScope_t
+ * @brief Stanje jednog mjerenja koje traje do izlaska iz bloka koda (koristi ga PLATFORM_TIMING_SCOPE).
+ * 
+ */
+typedef struct {
+    PlatformTimingStats_t* stats; /**< Statistika u koju se zapisuje mjerenje */
+    uint32_t start_cycles; /**< Vrijednost brojača ciklusa na početku mjerenja */
+} PlatformTimingScope_t;
+
+/**
+ * @brief Zapisuje jedno mjerenje u statistiku.
+ * 
+ * @param stats Pokazivač na statistiku
+ * @param cycles Trajanje mjerenja u ciklusima procesora
+ */
+void platform_timing_record(PlatformTimingStats_t* stats, uint32_t cycles);
+
+/**
+ * @brief Završava mjerenje bloka koda (poziva se automatski na izlasku iz bloka).
+ * 
+ * @param scope Pokazivač na stanje mjerenja
+ */
+void platform_timing_scope_end(PlatformTimingScope_t* scope);
+
+/**
+ * @brief Briše statistiku mjerenja.
+ * 
+ * @param stats Pokazivač na statistiku
+ */
+void platform_timing_reset(PlatformTimingStats_t* stats);
+
+#define PLATFORM_TIMING_CONCAT_(a, b) a##b
+#define PLATFORM_TIMING_CONCAT(a, b) PLATFORM_TIMING_CONCAT_(a, b)
+
+#if PLATFORM_TIMING_ENABLED
+/**
+ * @brief Mjeri vrijeme izvođenja od mjesta poziva do kraja trenutnog bloka koda.
+ * 
+ * Primjer: { PLATFORM_TIMING_SCOPE(&parse_timing); parse(...); }
+ */
+#define PLATFORM_TIMING_SCOPE(stats_ptr) \
+    PlatformTimingScope_t PLATFORM_TIMING_CONCAT(timing_scope_, __LINE__) \
+    __attribute__((cleanup(platform_timing_scope_end))) = { (stats_ptr), platform_get_cycle_count() }
+
+/**
+ * @brief Započinje imenovano mjerenje (završava se s PLATFORM_TIMING_END).
+ * 
+ */
+#define PLATFORM_TIMING_BEGIN(name) uint32_t PLATFORM_TIMING_CONCAT(name, _timing_start) = platform_get_cycle_count()
+
+/**
+ * @brief Završava imenovano mjerenje i zapisuje ga u statistiku.
+ * 
+ */
+#define PLATFORM_TIMING_END(name, stats_ptr) \
+    platform_timing_record((stats_ptr), platform_get_cycle_count() - PLATFORM_TIMING_CONCAT(name, _timing_start))
+#else
+#define PLATFORM_TIMING_SCOPE(stats_ptr) do {} while(0)
+#define PLATFORM_TIMING_BEGIN(name) do {} while(0)
+#define PLATFORM_TIMING_END(name, stats_ptr) do {} while(0)
+#endif
\ No newline at end of file
@@ -0,0 +1,147 @@
+/**
+ * @file platform_trace.h
+ * @author Marko Fuček
+ * @brief Platform API za binarni trace događaja u sustavu.
+ * 
+ * Ovaj modul bilježi kratke binarne zapise o događajima (slanje/primanje iz queue-a, parsiranje,
+ * dekodiranje, slanje mrežom, buđenje taskova) s vremenom u mikrosekundama. Svaka jezgra ima vlastiti
+ * ring fiksne veličine u koji se upisuje bez zaključavanja, pa bilježenje gotovo ne mijenja vremenske
+ * odnose među taskovima (za razliku od printf ispisa).
+ * 
+ * Zapisi se mogu ispisati na konzolu ili poslati mrežom, a na računalu se pretvaraju u Chrome trace
+ * JSON (tools/trace_to_chrome.py) koji se otvara u chrome://tracing ili Perfetto.
+ * 
+ * @note Kada je ring pun, najstariji zapisi se prepisuju.
+ * 
+ * @version 0.1
+ * @date 2026-05-11
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+#pragma once
+#include "stdio.h"
+#include "stdint.h"
+#include "stdbool.h"
+
+/**
+ * @brief Uključuje (1) ili isključuje (0) bilježenje trace događaja.
+ * 
+ * @note Kada je isključeno, PLATFORM_TRACE makro se prevodi u praznu naredbu, a memorija za ringove se ne rezervira.
+ * @note Po defaultu je isključeno - uključuje se za cijeli build opcijom MMWAVE_TRACE (idf.py -DMMWAVE_TRACE=ON build),
+ * samo za stress test i benchmarke čiji se trace ispisuje.
+ */
+#ifndef PLATFORM_TRACE_ENABLED
+#define PLATFORM_TRACE_ENABLED 0
+#endif
+
+/**
+ * @brief Broj zapisa u ringu jedne jezgre (mora biti potencija broja 2).
+ * 
+ */
+#ifndef PLATFORM_TRACE_RING_LEN
+#define PLATFORM_TRACE_RING_LEN 256
+#endif
+
+/**
+ * @brief Broj znakova naziva taska koji se sprema u zapis.
+ * 
+ */
+#define PLATFORM_TRACE_TASK_NAME_LEN 4
+
+/**
+ * @enum PlatformTraceEvent
+ * @brief Vrste događaja koji se bilježe.
+ * 
+ * @note Vrijednosti su dio formata zapisa - nove vrste dodaju se isključivo na kraj.
+ */
+typedef enum {
+    PLATFORM_TRACE_TASK_WAKE, /**< Task se probudio (arg: razlog, npr. tip eventa) */
+    PLATFORM_TRACE_QUEUE_SEND, /**< Element poslan u queue (arg: duljina) */
+    PLATFORM_TRACE_QUEUE_RECV, /**< Element primljen iz queue-a (arg: duljina) */
+    PLATFORM_TRACE_PARSE_BEGIN, /**< Početak parsiranja primljenih bajtova (arg: broj bajtova) */
+    PLATFORM_TRACE_PARSE_END, /**< Kraj parsiranja primljenih bajtova (arg: broj bajtova) */
+    PLATFORM_TRACE_FRAME, /**< Parser je prepoznao frame (arg: duljina semantičkih podataka) */
+    PLATFORM_TRACE_DECODE_BEGIN, /**< Početak dekodiranja frame-a (arg: ctrl << 8 | cmd) */
+    PLATFORM_TRACE_DECODE_END, /**< Kraj dekodiranja frame-a (arg: ctrl << 8 | cmd) */
+    PLATFORM_TRACE_NET_SEND, /**< Paket poslan mrežom (arg: duljina) */
+    PLATFORM_TRACE_UART_TX /**< Frame zapisan na UART TX (arg: duljina) */
+} PlatformTraceEvent;
+
+/**
+ * @struct PlatformTraceRecord_t
+ * @brief Jedan binarni trace zapis (12 bajtova).
+ * 
+ */
+typedef struct __attribute__((packed)) {
+    uint32_t timestamp_us; /**< Vrijeme događaja u mikrosekundama (preljev nakon ~71 min) */
+    uint8_t core; /**< Jezgra na kojoj se događaj dogodio */
+    uint8_t event; /**< Vrsta događaja (PlatformTraceEvent) */
+    uint16_t arg; /**< Dodatni podatak ovisan o vrsti događaja */
+    char task[PLATFORM_TRACE_TASK_NAME_LEN]; /**< Početak naziva taska (bez '\0' ako je naziv dulji) */
+} PlatformTraceRecord_t;
+
+/**
+ * @brief Bilježi događaj u ring jezgre na kojoj se pozivatelj izvodi.
+ * 
+ * Funkcija ne blokira i ne zaključava, te se smije pozivati iz taska i iz ISR-a.
+ * 
+ * @param event Vrsta događaja
+ * @param arg Dodatni podatak
+ */
+void platform_trace_record(PlatformTraceEvent event, uint16_t arg);
+
+/**
+ * @brief Privremeno uključuje ili isključuje bilježenje (npr. za vrijeme čitanja zapisa).
+ * 
+ * @param enabled true za uključivanje, false za isključivanje
+ */
+void platform_trace_set_enabled(bool enabled);
+
+/**
+ * @brief Briše sve zapise iz ringova.
+ * 
+ */
+void platform_trace_clear(void);
+
+/**
+ * @brief Vraća ukupan broj zapisa u svim ringovima.
+ * 
+ * @return Broj zapisa
+ */
+size_t platform_trace_count(void);
+
+/**
+ * @brief Kopira zapise iz ringova (redom po jezgrama, unutar jezgre od najstarijeg).
+ * 
+ * Zapisi su numerirani od 0 do platform_trace_count() - 1, pa se mogu čitati u dijelovima.
+ * 
+ * @param first Indeks prvog zapisa koji se kopira
+ * @param out Pokazivač na polje u koje se kopiraju zapisi
+ * @param max Najveći broj zapisa koji se kopira
+ * @return Broj kopiranih zapisa
+ * 
+ * @note Prije čitanja potrebno je isključiti bilježenje (platform_trace_set_enabled(false)) kako se zapisi ne bi
+ * mijenjali tijekom čitanja.
+ */
+size_t platform_trace_copy(size_t first, PlatformTraceRecord_t* out, size_t max);
+
+/**
+ * @brief Ispisuje sve zapise na konzolu u tekstualnom obliku i briše ringove.
+ * 
+ * Svaki zapis je jedna linija "TRACE,<us>,<core>,<event>,<arg>,<task>" između linija "TRACE_BEGIN" i "TRACE_END".
+ * Bilježenje je isključeno za vrijeme ispisa.
+ * 
+ */
+void platform_trace_dump_console(void);
+
+#if PLATFORM_TRACE_ENABLED
+/**
+ * @brief Bilježi trace događaj (prevodi se u praznu naredbu kada je PLATFORM_TRACE_ENABLED 0).
+ * 
+ */
+#define PLATFORM_TRACE(event, arg) platform_trace_record((event), (uint16_t)(arg))
+#else
+#define PLATFORM_TRACE(event, arg) ((void)0)
+#endif
\ No newline at end of file
@@ -25,8 +25,23 @@
 #include "stdint.h"
 #include "stdbool.h"
 #include "board.h"
+#include "platform/platform_events.h"
 
-extern bool volatile hal_dispatcher_ended_flag;
+/**
+ * @brief Uključuje dispatcher task (event converter) u build.
+ * 
+ * Dispatcher zauzima vlastiti statički stack (i platform event queue). Ako svi korisnici UART-a
+ * rade u direktnom načinu (platform_uart_event_wait()), postavljanjem na 0 ta se memorija ne rezervira,
+ * a platform_uart_event_converter_start() vraća UART_ERROR.
+ * 
+ * @note Po defaultu se izvodi iz DIRECT_UART_EVENTS (board_mmwave_uart_config.h) - dispatcher se ugrađuje
+ * samo kada board ne koristi direktni način. Za mjerenje oba načina (benchmark) uključuje se opcijom MMWAVE_UART_DISPATCHER
+ * (idf.py -DMMWAVE_UART_DISPATCHER=ON build).
+ */
+#ifndef PLATFORM_UART_DISPATCHER_ENABLED
+#include "board_mmwave_uart_config.h"
+#define PLATFORM_UART_DISPATCHER_ENABLED (!DIRECT_UART_EVENTS)
+#endif
 
 /**
  * @enum UARTStatus
@@ -63,6 +78,15 @@ typedef struct
  */
 UARTStatus platform_uart_set_rx_threshold(const BoardUartId id, uint32_t bytes);
 
+/**
+ * @brief Postavlja RX timeout - nakon koliko vremena tišine na liniji ISR šalje UART_DATA event s manje od threshold bajtova.
+ * 
+ * @param id Logički UART id
+ * @param symbols Timeout izražen u trajanju jednog UART simbola (znaka) na zadanom baudrateu
+ * @return Status UART operacije
+ */
+UARTStatus platform_uart_set_rx_timeout(const BoardUartId id, uint8_t symbols);
+
 /**
  * @brief Vrši inicijalizaciju UART drivera korištenjem zadane konfiguracije.
  * 
@@ -80,6 +104,20 @@ UARTStatus platform_uart_init(const BoardUartId id, const platform_uart_config_t
  */
 UARTStatus platform_uart_flush(const BoardUartId id);
 
+/**
+ * @brief Čisti RX buffer UART-a i odbacuje sve UART evente koji čekaju u event queue-u drivera.
+ * 
+ * Odbacuju se i već prevedeni eventi u platform event queue-u te zapamćeni položaji kraja frame-a,
+ * pa su nakon poziva eventi ponovno usklađeni s podatcima u RX bufferu.
+ * 
+ * Koristi se prije pokretanja čitanja u direktnom načinu (fresh start), jer se eventi stvaraju čim se driver inicijalizira,
+ * te za oporavak nakon preljeva RX FIFO-a ili RX buffera.
+ * 
+ * @param id Logički UART id
+ * @return Status UART operacije
+ */
+UARTStatus platform_uart_flush_input(const BoardUartId id);
+
 /**
  * @brief Piše podatke na UART.
  * 
@@ -112,9 +150,88 @@ UARTStatus platform_uart_event_converter_start(const BoardUartId id);
 /**
  * @brief Zaustavlja task koji vrši konverziju ISR evenata u platform evente i oslobađa zauzetu memoriju.
  * 
+ * Ako dispatcher nije pokrenut, budi pozivatelja koji čeka u platform_uart_event_wait() (direktni način).
  */
 void platform_uart_event_converter_stop(void);
 
+/**
+ * @brief Provjerava je li task za konverziju ISR evenata završio s radom (ne blokira).
+ * 
+ * @return true ako task nije pokrenut ili je završio s radom
+ * @return false ako task još radi
+ */
+bool platform_uart_event_converter_ended(void);
+
+/**
+ * @brief Čeka (blokirajuće) da task za konverziju ISR evenata završi s radom.
+ * 
+ * Task završava nakon što su onemogućeni RX interruptovi (ili je pozvan platform_uart_event_converter_stop())
+ * i obrađeni su svi do tada pristigli UART eventi.
+ * 
+ * @param timeout_in_ms Vrijeme čekanja u ms (PLATFORM_SIGNAL_WAIT_FOREVER za beskonačno)
+ * @return UART_OK ako je task završio, UART_TIMEOUT ako je isteklo vrijeme čekanja
+ */
+UARTStatus platform_uart_event_converter_wait_ended(uint32_t timeout_in_ms);
+
+/**
+ * @brief Čeka (blokirajuće) sljedeći UART event direktno na event queue-u UART drivera (direktni način).
+ * 
+ * Event se prevodi u platform event u kontekstu pozivatelja, bez dispatcher taska i platform event queue-a -
+ * jedan prijelaz kroz queue i jedna promjena konteksta manje po eventu.
+ * 
+ * Kod platform_ISR_disable() i platform_uart_event_converter_stop() pozivatelj se budi eventom tipa
+ * PLATFORM_EVENT_NONE.
+ * 
+ * @param event Pokazivač na strukturu u koju se sprema prevedeni event
+ * @param timeout_in_ms Vrijeme čekanja u ms
+ * @return PLATFORM_EVENT_OK ako je event dohvaćen, PLATFORM_EVENT_TIMEOUT ako je isteklo vrijeme čekanja,
+ * PLATFORM_EVENT_ERROR ako driver nije inicijaliziran ili je event NULL
+ * 
+ * @warning Ne smije se koristiti istovremeno s pokrenutim dispatcher taskom (oba čitaju isti queue).
+ */
+EventStatus platform_uart_event_wait(PlatformEvent_t* event, uint32_t timeout_in_ms);
+
+/**
+ * @brief Vraća broj UART evenata koji čekaju u event queue-u UART drivera (ne blokira).
+ * 
+ * @return Broj evenata u queue-u, 0 ako driver nije inicijaliziran
+ */
+size_t platform_uart_get_num_of_pending_events(void);
+
+/**
+ * @brief Uključuje detekciju kraja frame-a po završnom bajtu.
+ * 
+ * Svaki primljeni tail_byte javlja se eventom PLATFORM_EVENT_FRAME_END, a RX_DATA eventi
+ * (threshold i timeout) se dok je detekcija uključena odbacuju - korisnik čita podatke samo do granica frame-a.
+ * 
+ * @param id Logički UART id
+ * @param tail_byte Završni bajt frame-a
+ * @return Status UART operacije
+ * 
+ * @note Hardver detektira samo niz istih znakova, pa se detektira jedan (zadnji) bajt završetka frame-a.
+ * Isti bajt unutar payload-a daje lažnu granicu - korisnik mora podatke obrađivati kao tok (stream).
+ */
+UARTStatus platform_uart_enable_frame_end_detection(const BoardUartId id, uint8_t tail_byte);
+
+/**
+ * @brief Isključuje detekciju kraja frame-a i vraća isporuku RX_DATA evenata.
+ * 
+ * @param id Logički UART id
+ * @return Status UART operacije
+ */
+UARTStatus platform_uart_disable_frame_end_detection(const BoardUartId id);
+
+/**
+ * @brief Vraća broj bajtova u RX bufferu do i uključujući najstariji detektirani kraj frame-a.
+ * 
+ * Poziva se po jednom za svaki PLATFORM_EVENT_FRAME_END, neposredno prije čitanja. Ako je zapis o položaju
+ * izgubljen (preljev interne liste položaja), vraća sve trenutno primljene bajtove.
+ * 
+ * @param id Logički UART id
+ * @return Broj bajtova koje treba pročitati (0 ako nema podataka)
+ */
+size_t platform_uart_get_frame_end_len(const BoardUartId id);
+
 /**
  * @brief Vrši deinicijalizaciju UART drivera.
  * 
@@ -11,9 +11,13 @@
  * [2] mmWave core test
  * [3] application test
  * [4] stress test
+ * [5] benchmarki performansi
  * 
  * @note Mogu se odkomentirati sve linije ako se žele izvršiti svi testovi.
  * 
+ * @note Za stress test i benchmarke s ispisom trace zapisa build se pokreće s uključenim traceom:
+ * idf.py -DMMWAVE_TRACE=ON build flash monitor
+ * 
  * @version 0.1
  * @date 2026-01-24
  * 
@@ -28,6 +32,7 @@
 #include "tests/test_mmwave_core.h"
 #include "tests/test_stress.h"
 #include "tests/dataset_collector.h"
+#include "tests/test_benchmark.h"
 
 void app_main(void)
 {
@@ -35,5 +40,6 @@ void app_main(void)
     //mmwave_core_run_test();
     //app_mmwave_run_test();
     //stress_run_test();
+    //benchmark_run_all();
     run_dataset_collector();
 }
\ No newline at end of file
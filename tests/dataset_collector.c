@@ -51,7 +51,14 @@ void run_dataset_collector(void)
     stop_flag = false;
     task_ended = false;
 
-    TaskConfig_t st = {collector_task, "stress_task", 12000, NULL, 8};
+    TaskConfig_t st = {
+        .task_function = collector_task,
+        .task_name = "stress_task",
+        .task_stack = 12000,
+        .task_parameters = NULL,
+        .task_priority = 8,
+        .task_core = PLATFORM_TASK_CORE_ANY
+    };
     c_task = platform_create_task(&st);
 
     platform_delay_task(1000);
@@ -91,12 +98,23 @@ void run_dataset_collector(void)
                     recording_active = true;
                     mmwave_init();
                     mmwave_start();
-                    platform_delay_task(1000);
+                    if(mmwave_wait_ready(COLLECTOR_READY_TIMEOUT_MS) != APP_SENSOR_OK) {
+                        printf("[COLLECTOR] Senzor nije javio zavrsenu inicijalizaciju\n");
+                    }
                     
-                    app_inquiry_scene_settings_set(LIVING_ROOM);
-                    app_inquiry_sensitivity_settings_set(SENSITIVITY_3);
-                    app_inquiry_time_for_no_person_set(TEN_SEC);
-                    app_inquiry_uof_output_switch_set(TURN_ON);
+                    MmwaveConfigProfile profile = {
+                        .fields = MMWAVE_CONFIG_BASIC,
+                        .scene = LIVING_ROOM,
+                        .sensitivity = SENSITIVITY_3,
+                        .time_for_no_person = TEN_SEC,
+                        .uof_output_switch = TURN_ON
+                    };
+                    MmwaveConfigResult config_result;
+                    //nakon ponovnog pokretanja senzor već ima ove postavke, pa se ništa ne šalje
+                    if(mmwave_sync_config(&profile, &config_result, COLLECTOR_CONFIG_TIMEOUT_MS) != APP_SENSOR_OK) {
+                        printf("[COLLECTOR] Postavke nisu potvrdene (neuspjele: 0x%lx)\n",
+                            (unsigned long)config_result.failed);
+                    }
                 }
                 break;
             case STOP_RECORDING:
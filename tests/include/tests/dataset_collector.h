@@ -8,6 +8,8 @@
 #define PROTOCOL_NUM 0xFF
 
 #define SHUTDOWN_TIMEOUT 30000
+#define COLLECTOR_CONFIG_TIMEOUT_MS 2000 //najdulje čekanje na potvrdu postavki senzora
+#define COLLECTOR_READY_TIMEOUT_MS 5000 //najdulje čekanje da senzor postane spreman nakon pokretanja
 
 typedef enum {
     START_RECORDING = 0x01,
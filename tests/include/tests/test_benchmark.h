@@ -0,0 +1,63 @@
+#pragma once
+#include "stdio.h"
+
+#define BENCHMARK_JITTER_PERIOD_MS 50 //period probe taska u jitter benchmarku
+#define BENCHMARK_JITTER_SAMPLES 100 //broj mjerenja po scenariju jitter benchmarka
+#define BENCHMARK_LOAD_BUSY_MS 20 //koliko dugo load task zauzima jezgru u jednom naletu
+#define BENCHMARK_LOAD_IDLE_MS 30 //pauza load taska između dva naleta
+#define BENCHMARK_UART_SAMPLES 50 //broj HEARTBEAT upita po načinu dohvata UART evenata
+#define BENCHMARK_UART_PERIOD_MS 20 //pauza između dva HEARTBEAT upita
+#define BENCHMARK_UART_TIMEOUT_MS 500 //najdulje čekanje na HEARTBEAT odgovor
+#define BENCHMARK_ALLOC_WINDOW_MS 10000 //trajanje mjerenja alokacija po frame-u
+#define BENCHMARK_ALLOC_POLL_MS 50 //period pražnjenja cache-a tijekom mjerenja alokacija
+#define BENCHMARK_RING_CAPACITY 64 //kapacitet ringa u contention benchmarku (potencija broja 2)
+#define BENCHMARK_RING_POLLERS 4 //najveći broj istodobnih čitatelja ringa
+#define BENCHMARK_RING_EVENTS 20000 //broj eventova koje pisač upisuje po scenariju
+#define BENCHMARK_RING_BURST 32 //broj upisa između dvije pauze pisača
+#define BENCHMARK_RING_POLL_TIMEOUT_MS 1000 //timeout čitatelja - dugo čekanje ne smije usporiti pisača
+#define BENCHMARK_DECODE_ITERATIONS 10000 //broj dekodiranja po vrsti poruke u benchmarku dekodera
+#define BENCHMARK_STARTUP_RUNS 2 //broj pokretanja managera u benchmarku pokretanja
+#define BENCHMARK_STARTUP_TIMEOUT_MS 10000 //najdulje trajanje jednog pokretanja (do prvog reporta)
+#define BENCHMARK_STARTUP_CONFIG_TIMEOUT_MS 1000 //najdulje čekanje na odgovore kod usklađivanja postavki
+
+/**
+ * @brief Mjeri jitter periodičkog taska uz konkurentno opterećenje, bez i s vezanjem taskova za jezgre.
+ * 
+ */
+void benchmark_task_jitter(void);
+
+/**
+ * @brief Uspoređuje latenciju UART evenata (HEARTBEAT round-trip) i zauzeće stacka s dispatcher taskom i u direktnom načinu.
+ * 
+ */
+void benchmark_uart_event_path(void);
+
+/**
+ * @brief Mjeri prosječan broj heap alokacija po primljenom frame-u uz pokrenut mmWave manager.
+ * 
+ */
+void benchmark_allocs_per_frame(void);
+
+/**
+ * @brief Mjeri latenciju upisa u ring eventova s jednim i s više čitatelja koji čekaju s dugim timeoutom.
+ * 
+ */
+void benchmark_event_ring_contention(void);
+
+/**
+ * @brief Mjeri trajanje dekodiranja jednog frame-a (ns/frame) za svaku vrstu response-a, reporte i nepoznate frame-ove.
+ * 
+ */
+void benchmark_decoder_dispatch(void);
+
+/**
+ * @brief Mjeri vrijeme od pokretanja managera do prvog valjanog reporta s postavljenim profilom, uz preskakanje već postavljenih postavki.
+ * 
+ */
+void benchmark_startup_config(void);
+
+/**
+ * @brief Pokreće sve benchmarke redom.
+ * 
+ */
+void benchmark_run_all(void);
\ No newline at end of file
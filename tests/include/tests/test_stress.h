@@ -3,5 +3,9 @@
 
 #define TEST_DURATION (30 * 60 * 1000) //trajanje testa - 30 minuta
 #define SYSTEM_STATISTICS_LOG_INTERVAL (30 * 1000) //svakih koliko logiramo stanje - 30 sekundi
+#define STRESS_CONFIG_TIMEOUT_MS 2000 //najdulje čekanje na potvrdu postavki senzora
+#define STRESS_READY_TIMEOUT_MS 5000 //najdulje čekanje da senzor postane spreman nakon pokretanja
+#define STRESS_HEARTBEAT_PERIOD_MS 1000 //period raspoređenog HEARTBEAT upita
+#define STRESS_ENERGY_PERIOD_MS 500 //period raspoređenog upita UOF existence energy
 
 void stress_run_test(void);
\ No newline at end of file
@@ -9,7 +9,9 @@
  * - Inicijalizacije sustava
  * - Pokretanja sustava
  * - Registriranja funkcija koje se pozivaju kao callback na dolazak report-ova i response-ova
+ * - Pretplate (v2 callback API) na presence reporte i response-ove s brojačem eventova kao kontekstom
  * - Slanja više inquirija (upita) na senzor i čekanja odgovora na sve njih u Standard Mode
+ * - Čitanja postavki upitima koji blokiraju do dolaska odgovora (awaitable inquiry)
  * - Čekanja dolaska više reportova sa senzora u Standard Mode
  * - Prebacivanja u Underlying Open Function Mode način rada senzora
  * - Slanja više inquirija (upita) na senzor i čekanja odgovora na sve njih u Underlying Open Function Mode
@@ -35,6 +37,8 @@
 #include "platform/platform.h"
 
 #define EVENT_POLL_TIMEOUT_IN_MS 20
+#define EVENT_AWAIT_TIMEOUT_IN_MS 1000 //najdulje čekanje odgovora na upit s čekanjem
+#define READY_TIMEOUT_IN_MS 5000 //najdulje čekanje da senzor postane spreman nakon pokretanja
 
 void fun1(DecodedReport report)
 {
@@ -46,6 +50,33 @@ void fun2(DecodedResponse response)
     printf("[APP CALLBACK] Callback funkcija primila response\n");
 }
 
+/**
+ * @struct SubscriberCounts
+ * @brief Brojač eventova koji v2 pretplatnik dobiva kao kontekst.
+ * 
+ */
+typedef struct {
+    int presence_reports; /**< Broj primljenih presence reporta */
+    int responses; /**< Broj primljenih response-ova */
+} SubscriberCounts;
+
+static void sub_on_report(const DecodedReport* report, void* user)
+{
+    if(report->has_presence_info) {
+        ((SubscriberCounts*)user)->presence_reports++;
+    }
+}
+
+static void sub_on_response(const DecodedResponse* response, void* user)
+{
+    ((SubscriberCounts*)user)->responses++;
+}
+
+static void on_ready(void* user)
+{
+    (*(int*)user)++;
+}
+
 void analise_event(int* reports_to_wait, int* responses_to_wait, bool poll_reports)
 {
     DecodedReport sensor_report;
@@ -106,11 +137,11 @@ void analise_event(int* reports_to_wait, int* responses_to_wait, bool poll_repor
                 }
             } else if(sensor_report.has_uof_report) { //ako je UOF report
                 int existence_e = sensor_report.uof_rep.existence_energy;
-                float static_d = sensor_report.uof_rep.static_distance;
+                int static_d = sensor_report.uof_rep.static_distance_cm;
                 int motion_e = sensor_report.uof_rep.motion_energy;
-                float motion_d = sensor_report.uof_rep.motion_distance;
-                float motion_s = sensor_report.uof_rep.motion_speed;
-                printf("[APP test] UOF report: Existence energy: %d, Static distance: %f, Motion energy: %d, Motion distance: %f, Motion speed: %f\n",
+                int motion_d = sensor_report.uof_rep.motion_distance_cm;
+                int motion_s = sensor_report.uof_rep.motion_speed_cms;
+                printf("[APP test] UOF report: Existence energy: %d, Static distance: %d cm, Motion energy: %d, Motion distance: %d cm, Motion speed: %d cm/s\n",
                     existence_e, static_d, motion_e, motion_d, motion_s);
             } else {
                 printf("[APP test] Report bez prepoznatog payloada\n");
@@ -137,19 +168,19 @@ void analise_event(int* reports_to_wait, int* responses_to_wait, bool poll_repor
             printf("[APP test] Module reset uspjesan\n");
             break;
         case PRODUCT_MODEL:
-            printf("[APP test] Product model: %d\n", sensor_response.data[0]);
+            printf("[APP test] Product model: %.*s\n", (int)sensor_response.data_l, (const char*)sensor_response.data);
             break;
         case PRODUCT_ID:
-            printf("[APP test] Product ID: %d\n", sensor_response.data[0]);
+            printf("[APP test] Product ID: %.*s\n", (int)sensor_response.data_l, (const char*)sensor_response.data);
             break;
         case INIT_STATUS:
             printf("[APP test] Inicijalizacija uspjesna\n");
             break;
         case HARDWARE_MODEL:
-            printf("[APP test] Hardware model: %d\n", sensor_response.data[0]);
+            printf("[APP test] Hardware model: %.*s\n", (int)sensor_response.data_l, (const char*)sensor_response.data);
             break;
         case FIRMWARE_VERSION:
-            printf("[APP test] Firmware version: %d\n", sensor_response.data[0]);
+            printf("[APP test] Firmware version: %.*s\n", (int)sensor_response.data_l, (const char*)sensor_response.data);
             break;
         case SCENE_SETTINGS:
             printf("[APP test] Scene settings postavljen\n");
@@ -277,12 +308,30 @@ void app_mmwave_run_test(void)
     printf("[APP test] Uspjesna inicijalizacija sustava\n");
 
     //Pokretanje sustava:
+    static int ready_count = 0;
+    mmwave_register_ready_callback(on_ready, &ready_count);
     if((status = mmwave_start()) != APP_SENSOR_OK) {
         printf("[APP test] Neuspjesno pokretanje sustava\n");
         return;
     }
     printf("[APP test] Uspjesno pokretanje sustava\n");
 
+    //upiti se šalju tek kada senzor javi završenu inicijalizaciju
+    if((status = mmwave_wait_ready(READY_TIMEOUT_IN_MS)) != APP_SENSOR_OK) {
+        printf("[APP test] Senzor nije postao spreman (status = %d)\n", status);
+        return;
+    }
+    printf("[APP test] Senzor je spreman (ready callback pozvan %d puta)\n", ready_count);
+
+    //podatci o uređaju čitaju se jednom nakon spremnosti, a ovaj dohvat ih služi iz cachea
+    MmwaveDeviceInfo device_info;
+    if(mmwave_get_device_info(&device_info, EVENT_AWAIT_TIMEOUT_IN_MS) == APP_SENSOR_OK) {
+        printf("[APP test] Uredaj: model=%s, id=%s, hw=%s, fw=%s\n", device_info.product_model,
+            device_info.product_id, device_info.hardware_model, device_info.firmware_version);
+    } else {
+        printf("[APP test] Podatci o uredaju nisu dostupni\n");
+    }
+
     printf("[APP test] Registracija funkcija koje sustav zove kod javljanja eventa\n");
     if(registrate_onEvent_function(fun2, fun1) != APP_SENSOR_OK) {
         printf("[APP test] Neuspjesna registracija funkcija\n");
@@ -290,6 +339,20 @@ void app_mmwave_run_test(void)
     }
     printf("[APP test] Uspjesna registracija funkcija\n");
 
+    static SubscriberCounts sub_counts;
+    int sub_id = -1;
+    MmwaveSubscription sub = {
+        .on_report = sub_on_report,
+        .on_response = sub_on_response,
+        .user = &sub_counts,
+        .event_mask = MMWAVE_EVENT_MASK_REPORT(REPORT_KIND_PRESENCE) | MMWAVE_EVENT_MASK_RESPONSE
+    };
+    if(mmwave_subscribe(&sub, &sub_id) != APP_SENSOR_OK) {
+        printf("[APP test] Neuspjesna pretplata na evente\n");
+        return;
+    }
+    printf("[APP test] Uspjesna pretplata na evente (id = %d)\n", sub_id);
+
     printf("[APP test] Postavljanje scene i sensitivity (scene = Living room) (sensitivity = 3)\n");
 
     app_inquiry_scene_settings_set(LIVING_ROOM);
@@ -309,6 +372,22 @@ void app_mmwave_run_test(void)
     inquiries_sent++;
     platform_delay_task(100);
 
+    printf("[APP test] Provjera postavki upitima koji cekaju odgovor (scene i sensitivity)\n");
+    SceneMode scene_read;
+    SensitivityLevel sensitivity_read;
+    if(app_inquiry_scene_settings_get_await(&scene_read, EVENT_AWAIT_TIMEOUT_IN_MS) == APP_SENSOR_OK) {
+        printf("[APP test] Scene procitana s cekanjem: %d\n", scene_read);
+        inquiries_sent++; //odgovor je i u ringu
+    } else {
+        printf("[APP test] Odgovor na upit scene nije stigao\n");
+    }
+    if(app_inquiry_sensitivity_settings_get_await(&sensitivity_read, EVENT_AWAIT_TIMEOUT_IN_MS) == APP_SENSOR_OK) {
+        printf("[APP test] Sensitivity procitan s cekanjem: %d\n", sensitivity_read);
+        inquiries_sent++;
+    } else {
+        printf("[APP test] Odgovor na upit sensitivity nije stigao\n");
+    }
+
     printf("[APP test] Saljemo inquiry za presence\n");
     app_inquiry_presence();
     inquiries_sent++;
@@ -371,6 +450,14 @@ void app_mmwave_run_test(void)
         analise_event(&reports_to_wait_uof, &inquiries_sent, true);
     }
 
+    printf("[APP test] Pretplatnik primio %d presence reporta i %d response-ova\n", sub_counts.presence_reports,
+        sub_counts.responses);
+    if(mmwave_unsubscribe(sub_id) != APP_SENSOR_OK) {
+        printf("[APP test] Neuspjesno uklanjanje pretplate\n");
+    }
+
+    mmwave_register_ready_callback(NULL, NULL);
+
     //Zaustavljanje rada sustava:
     if((status = mmwave_stop()) != APP_SENSOR_OK) {
         printf("Neuspjesno zaustavljanje sustava\n");
@@ -0,0 +1,585 @@
+/**
+ * @file test_benchmark.c
+ * @author Marko Fuček
+ * @brief Benchmarki performansi sustava na uređaju.
+ * 
+ * Ovaj modul sadrži mjerenja koja se pokreću na stvarnom uređaju i ispisuju rezultate na konzolu.
+ * 
+ * Benchmarki:
+ * - Jitter periodičkog taska uz opterećenje, bez i s vezanjem taskova za jezgre
+ * - Latencija UART evenata (HEARTBEAT round-trip) i zauzeće stacka s dispatcher taskom i u direktnom načinu
+ * - Broj heap alokacija po primljenom frame-u kroz cijeli put (HAL -> dekoder -> cache)
+ * - Latencija upisa u ring eventova uz više istodobnih čitatelja (contention)
+ * - Trajanje dekodiranja jednog frame-a (ns/frame) po vrsti poruke
+ * - Vrijeme pokretanja (init -> spreman senzor -> prvi valjani report s postavljenim profilom) s cacheom postavki
+ * 
+ * @version 0.1
+ * @date 2026-05-06
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+#include <stdio.h>
+#include "tests/test_benchmark.h"
+#include "platform/platform.h"
+#include "my_hal/hal_mmwave.h"
+#include "my_hal/system_monitor.h"
+#include "esp32_board.h"
+#include "board_mmwave_uart_config.h"
+#include "mmwave_interface/mmwave.h"
+#include "mmwave_interface/mmwave_core_types.h"
+#include "mmwave_interface/mmwave_core_interface.h"
+#include "app/app_mmwave.h"
+#include "app/app_event_ring.h"
+#include "app/app_mmwave_decoder.h"
+
+#define JITTER_SIGNAL_STOP (1 << 0) //zaustavljanje load taska
+#define JITTER_SIGNAL_PROBE_DONE (1 << 1) //probe task je završio mjerenje
+#define JITTER_SIGNAL_LOAD_DONE (1 << 2) //load task je završio
+
+static mmWave_core_interface bench_core_int = {
+    .mmwave_parse_data = mmwave_parse_data,
+    .mmwave_core_init = mmwave_core_init,
+    .mmwave_core_stop = mmwave_core_stop,
+    .mmwave_build_frame = mmwave_build_frame,
+    .mmwave_core_reset = mmwave_core_reset
+};
+
+#define RING_SIGNAL_STOP (1 << 0) //čitatelji završavaju kad isprazne ring
+#define RING_SIGNAL_PRODUCER_DONE (1 << 1) //pisač je upisao sve evente
+#define RING_SIGNAL_POLLER_DONE(i) (1 << (2 + (i))) //čitatelj i je završio
+
+static PlatformSignalHandle jitter_signal;
+static uint32_t jitter_max;
+static uint32_t jitter_sum;
+
+/**
+ * @brief Task koji simulira opterećenje jezgre (npr. mrežnu obradu) u naletima.
+ * 
+ * @param arg Ne koristi se
+ */
+static void load_task(void* arg)
+{
+    for(;;) {
+        if(platform_signal_get(jitter_signal) & JITTER_SIGNAL_STOP) {
+            platform_signal_set(jitter_signal, JITTER_SIGNAL_LOAD_DONE);
+            platform_delete_task(NULL);
+        }
+        uint32_t start = platform_getNumOfMs();
+        while(platform_getNumOfMs() - start < BENCHMARK_LOAD_BUSY_MS) {
+            //zauzimamo jezgru
+        }
+        platform_delay_task(BENCHMARK_LOAD_IDLE_MS);
+    }
+}
+
+/**
+ * @brief Periodički task koji mjeri odstupanje stvarnog perioda buđenja od zadanog.
+ * 
+ * @param arg Ne koristi se
+ */
+static void probe_task(void* arg)
+{
+    jitter_max = 0;
+    jitter_sum = 0;
+    const uint32_t period_us = BENCHMARK_JITTER_PERIOD_MS * 1000;
+    uint64_t last = platform_getNumOfUs();
+    for(int i = 0; i < BENCHMARK_JITTER_SAMPLES; i++) {
+        platform_delay_task(BENCHMARK_JITTER_PERIOD_MS);
+        uint64_t now = platform_getNumOfUs();
+        uint32_t interval = (uint32_t)(now - last);
+        uint32_t jitter = (interval > period_us) ? (interval - period_us) : (period_us - interval);
+        if(jitter > jitter_max) {
+            jitter_max = jitter;
+        }
+        jitter_sum += jitter;
+        last = now;
+    }
+    platform_signal_set(jitter_signal, JITTER_SIGNAL_PROBE_DONE);
+    platform_delete_task(NULL);
+}
+
+/**
+ * @brief Pokreće jedan scenarij jitter benchmarka.
+ * 
+ * Load task ima veći prioritet od probe taska, pa probe kasni kad god dijele jezgru.
+ * 
+ * @param name Naziv scenarija za ispis
+ * @param probe_core Afinitet probe taska
+ * @param load_core Afinitet load taska
+ */
+static void run_jitter_case(const char* name, PlatformTaskCore probe_core, PlatformTaskCore load_core)
+{
+    platform_signal_clear(jitter_signal, JITTER_SIGNAL_STOP | JITTER_SIGNAL_PROBE_DONE | JITTER_SIGNAL_LOAD_DONE);
+
+    TaskConfig_t load = {load_task, "bench_load", 4096, NULL, 7, load_core};
+    TaskConfig_t probe = {probe_task, "bench_probe", 4096, NULL, 6, probe_core};
+    platform_create_task(&load);
+    platform_create_task(&probe);
+
+    platform_signal_wait(jitter_signal, JITTER_SIGNAL_PROBE_DONE, true, false, PLATFORM_SIGNAL_WAIT_FOREVER);
+    platform_signal_set(jitter_signal, JITTER_SIGNAL_STOP);
+    platform_signal_wait(jitter_signal, JITTER_SIGNAL_LOAD_DONE, true, false, PLATFORM_SIGNAL_WAIT_FOREVER);
+
+    printf("[BENCH JITTER] %s: avg=%lu us, max=%lu us (period %d ms, %d samples)\n", name,
+        (unsigned long)(jitter_sum / BENCHMARK_JITTER_SAMPLES), (unsigned long)jitter_max,
+        BENCHMARK_JITTER_PERIOD_MS, BENCHMARK_JITTER_SAMPLES);
+}
+
+void benchmark_task_jitter(void)
+{
+    jitter_signal = platform_signal_create();
+    if(jitter_signal == NULL) {
+        printf("[BENCH JITTER] ERROR: signal nije stvoren\n");
+        return;
+    }
+
+    run_jitter_case("bez afiniteta", PLATFORM_TASK_CORE_ANY, PLATFORM_TASK_CORE_ANY);
+    run_jitter_case("ista jezgra", PLATFORM_TASK_CORE_SENSOR, PLATFORM_TASK_CORE_SENSOR);
+    run_jitter_case("razdvojene jezgre", PLATFORM_TASK_CORE_SENSOR, PLATFORM_TASK_CORE_NETWORK);
+
+    platform_signal_delete(jitter_signal);
+    jitter_signal = NULL;
+}
+
+/**
+ * @brief Mjeri HEARTBEAT round-trip kroz HAL u jednom načinu dohvata UART evenata.
+ * 
+ * Round-trip uključuje slanje upita, odgovor senzora i cijeli RX put (ISR -> event -> RX task -> parser -> frame queue),
+ * pa je razlika između dva načina upravo cijena dodatnog prijelaza kroz dispatcher.
+ * 
+ * @param name Naziv scenarija za ispis
+ * @param direct true za direktni način, false za način s dispatcher taskom
+ */
+static void run_uart_path_case(const char* name, bool direct)
+{
+    hal_mmwave_config cfg = {
+        .id = ESP32_BOARD_UART_PROTOCOL_NUM,
+        .baudrate = BAUDRATE,
+        .data_bits = DATA_BITS,
+        .parity = PARITY,
+        .stop_bits = STOP_BITS,
+        .rx_buff_size = RX_BUFF_SIZE,
+        .tx_buff_size = TX_BUFF_SIZE,
+        .rx_thresh = RX_THRESH,
+        .rx_timeout = RX_TIMEOUT,
+        .rx_adaptive = RX_ADAPTIVE,
+        .frame_end_detection = FRAME_END_DETECTION,
+        .frame_tail_byte = FOOTER2,
+        .event_queue_len = EVENT_QUEUE_LEN,
+        .direct_events = direct
+    };
+    if(hal_mmwave_init(&cfg, &bench_core_int) != HAL_MMWAVE_OK || hal_mmwave_start() != HAL_MMWAVE_OK) {
+        printf("[BENCH UART] %s: ERROR kod pokretanja HAL-a\n", name);
+        hal_mmwave_deinit();
+        return;
+    }
+
+    uint8_t payload[] = {0x0F};
+    uint32_t rtt_max = 0;
+    uint64_t rtt_sum = 0;
+    int ok = 0;
+    for(int i = 0; i < BENCHMARK_UART_SAMPLES; i++) {
+        hal_mmwave_flush_frames();
+        uint64_t start = platform_getNumOfUs();
+        if(hal_mmwave_send_frame(payload, 1, 0x01, 0x01) != HAL_MMWAVE_OK) {
+            continue;
+        }
+        FrameData_t frame;
+        while((platform_getNumOfUs() - start) < (BENCHMARK_UART_TIMEOUT_MS * 1000)) {
+            if(hal_mmwave_get_frame_from_queue(&frame, 5) != HAL_MMWAVE_OK) {
+                continue;
+            }
+            bool heartbeat = (frame.len >= 2 && frame.data[0] == 0x01 && frame.data[1] == 0x01);
+            hal_mmwave_release_frame_memory(&frame);
+            if(heartbeat) {
+                uint32_t rtt = (uint32_t)(platform_getNumOfUs() - start);
+                if(rtt > rtt_max) {
+                    rtt_max = rtt;
+                }
+                rtt_sum += rtt;
+                ok++;
+                break;
+            }
+        }
+        platform_delay_task(BENCHMARK_UART_PERIOD_MS);
+    }
+
+    //Stack se čita prije zaustavljanja - nakon stop-a taskovi su odjavljeni iz system monitora
+    int task_count = system_monitor_task_count();
+    monitor_task_stats_t* stats = get_all_tasks_stats();
+    printf("[BENCH UART] %s: RTT avg=%lu us, max=%lu us (%d/%d odgovora), taskova: %d\n", name,
+        (unsigned long)(ok > 0 ? (rtt_sum / ok) : 0), (unsigned long)rtt_max, ok, BENCHMARK_UART_SAMPLES, task_count);
+    HalRxMetrics_t rx_metrics;
+    hal_mmwave_get_rx_metrics(&rx_metrics);
+    printf("[BENCH UART] %s: RX thresh=%lu B, timeout=%lu sym, wakeups/frame=%lu.%02lu\n", name,
+        (unsigned long)rx_metrics.rx_thresh, (unsigned long)rx_metrics.rx_timeout,
+        (unsigned long)(rx_metrics.wakeups_per_frame_x100 / 100), (unsigned long)(rx_metrics.wakeups_per_frame_x100 % 100));
+    for(int i = 0; i < task_count; i++) {
+        printf("[BENCH UART] %s: [%s] stack left: %lu B\n", name, stats[i].name, (unsigned long)stats[i].remaining_stack);
+    }
+
+    hal_mmwave_stop();
+    hal_mmwave_deinit();
+}
+
+/**
+ * @note Senzor mora biti spojen na protokolni UART. Benchmark ne smije raditi dok je pokrenut mmWave manager.
+ * 
+ */
+void benchmark_uart_event_path(void)
+{
+#if PLATFORM_UART_DISPATCHER_ENABLED
+    run_uart_path_case("dispatcher", false);
+#else
+    printf("[BENCH UART] dispatcher: preskoceno (build bez dispatchera, MMWAVE_UART_DISPATCHER=ON)\n");
+#endif
+    run_uart_path_case("direktno", true);
+}
+
+/**
+ * @note Senzor mora biti spojen na protokolni UART. Benchmark sam pokreće i zaustavlja mmWave manager.
+ * @note Mjeri se samo trenutni put (frame se dekodira na mjestu). Usporedna vrijednost prije te promjene (3 alokacije
+ * po frame-u: buffer core-a, kopija frame-a u decoder tasku i report/response) je analitička, dobivena čitanjem koda -
+ * stari put više ne postoji u stablu pa se ne mjeri.
+ * 
+ */
+void benchmark_allocs_per_frame(void)
+{
+    if(mmwave_init() != APP_SENSOR_OK || mmwave_start() != APP_SENSOR_OK) {
+        printf("[BENCH ALLOC] ERROR kod pokretanja mmWave managera\n");
+        mmwave_deinit();
+        return;
+    }
+    mmwave_wait_ready(BENCHMARK_STARTUP_TIMEOUT_MS);
+    app_inquiry_uof_output_switch_set(TURN_ON); //više reporta po sekundi
+
+    HalRxMetrics_t before;
+    hal_mmwave_get_rx_metrics(&before);
+    uint32_t allocs_before = platform_get_alloc_count();
+    uint32_t start = platform_getNumOfMs();
+
+    DecodedReport report;
+    DecodedResponse response;
+    while(platform_getNumOfMs() - start < BENCHMARK_ALLOC_WINDOW_MS) {
+        //praznimo cache kao network task, da se ne puni tijekom mjerenja
+        while(mmwave_poll_report(&report, 0)) {}
+        while(mmwave_poll_response(&response, 0)) {}
+        platform_delay_task(BENCHMARK_ALLOC_POLL_MS);
+    }
+
+    uint32_t allocs = platform_get_alloc_count() - allocs_before;
+    HalRxMetrics_t after;
+    hal_mmwave_get_rx_metrics(&after);
+    uint32_t frames = after.frames - before.frames;
+
+    mmwave_stop();
+    mmwave_deinit();
+
+    uint32_t per_frame_x100 = (frames > 0) ? (uint32_t)(((uint64_t)allocs * 100) / frames) : 0;
+    printf("[BENCH ALLOC] %lu alokacija / %lu frame-ova = %lu.%02lu alokacija po frame-u\n",
+        (unsigned long)allocs, (unsigned long)frames,
+        (unsigned long)(per_frame_x100 / 100), (unsigned long)(per_frame_x100 % 100));
+}
+
+static AppEventRing_t bench_ring;
+static DecodedReport bench_ring_storage[BENCHMARK_RING_CAPACITY];
+static uint32_t bench_ring_seq[BENCHMARK_RING_CAPACITY];
+static PlatformSignalHandle ring_signal;
+static uint32_t ring_push_max_us;
+static uint64_t ring_push_sum_us;
+static uint32_t ring_popped[BENCHMARK_RING_POLLERS];
+static uint32_t ring_out_of_order[BENCHMARK_RING_POLLERS];
+
+/**
+ * @brief Pisač - upisuje BENCHMARK_RING_EVENTS reporta u naletima i mjeri trajanje svakog upisa.
+ * 
+ * @param arg Ne koristi se
+ */
+static void ring_producer_task(void* arg)
+{
+    DecodedReport report = {0};
+    report.has_bmp_info = true;
+    ring_push_max_us = 0;
+    ring_push_sum_us = 0;
+    for(int i = 0; i < BENCHMARK_RING_EVENTS; i++) {
+        report.bmp_info = i;
+        uint64_t start = platform_getNumOfUs();
+        app_event_ring_push(&bench_ring, &report);
+        uint32_t dt = (uint32_t)(platform_getNumOfUs() - start);
+        if(dt > ring_push_max_us) {
+            ring_push_max_us = dt;
+        }
+        ring_push_sum_us += dt;
+        if((i % BENCHMARK_RING_BURST) == (BENCHMARK_RING_BURST - 1)) {
+            platform_delay_task(1);
+        }
+    }
+    platform_signal_set(ring_signal, RING_SIGNAL_PRODUCER_DONE);
+    platform_delete_task(NULL);
+}
+
+/**
+ * @brief Čitatelj - vadi evente s dugim timeoutom dok ne dobije stop i ring ne bude prazan.
+ * 
+ * Provjerava i da eventovi koje jedan čitatelj dobije dolaze rastućim redom.
+ * 
+ * @param arg Indeks čitatelja
+ */
+static void ring_poller_task(void* arg)
+{
+    int idx = (int)(intptr_t)arg;
+    DecodedReport report;
+    int last = -1;
+    ring_popped[idx] = 0;
+    ring_out_of_order[idx] = 0;
+    for(;;) {
+        if(app_event_ring_pop(&bench_ring, &report, BENCHMARK_RING_POLL_TIMEOUT_MS)) {
+            if(report.bmp_info <= last) {
+                ring_out_of_order[idx]++;
+            }
+            last = report.bmp_info;
+            ring_popped[idx]++;
+        } else if(platform_signal_get(ring_signal) & RING_SIGNAL_STOP) {
+            break;
+        }
+    }
+    platform_signal_set(ring_signal, RING_SIGNAL_POLLER_DONE(idx));
+    platform_delete_task(NULL);
+}
+
+/**
+ * @brief Pokreće jedan scenarij contention benchmarka.
+ * 
+ * Čitatelji imaju veći prioritet od pisača, pa na zajedničkoj jezgri uvijek prekidaju pisača.
+ * 
+ * @param pollers Broj istodobnih čitatelja (najviše BENCHMARK_RING_POLLERS)
+ */
+static void run_ring_case(int pollers)
+{
+    if(!app_event_ring_init(&bench_ring, bench_ring_storage, bench_ring_seq, sizeof(DecodedReport),
+        BENCHMARK_RING_CAPACITY)) {
+        printf("[BENCH RING] ERROR: ring nije inicijaliziran\n");
+        return;
+    }
+    PlatformSignalBits all_done = 0;
+    for(int i = 0; i < pollers; i++) {
+        all_done |= RING_SIGNAL_POLLER_DONE(i);
+    }
+    platform_signal_clear(ring_signal, RING_SIGNAL_STOP | RING_SIGNAL_PRODUCER_DONE | all_done);
+
+    for(int i = 0; i < pollers; i++) {
+        TaskConfig_t poller = {ring_poller_task, "bench_poll", 4096, (void*)(intptr_t)i, 7, PLATFORM_TASK_CORE_ANY};
+        platform_create_task(&poller);
+    }
+    TaskConfig_t producer = {ring_producer_task, "bench_push", 4096, NULL, 6, PLATFORM_TASK_CORE_SENSOR};
+    platform_create_task(&producer);
+
+    platform_signal_wait(ring_signal, RING_SIGNAL_PRODUCER_DONE, true, false, PLATFORM_SIGNAL_WAIT_FOREVER);
+    platform_signal_set(ring_signal, RING_SIGNAL_STOP);
+    platform_signal_wait(ring_signal, all_done, true, true, PLATFORM_SIGNAL_WAIT_FOREVER);
+
+    uint32_t popped = 0;
+    uint32_t out_of_order = 0;
+    for(int i = 0; i < pollers; i++) {
+        popped += ring_popped[i];
+        out_of_order += ring_out_of_order[i];
+    }
+    uint32_t overwritten = app_event_ring_overwritten(&bench_ring);
+    printf("[BENCH RING] %d citatelja: push avg=%lu us, max=%lu us; procitano %lu + prepisano %lu od %d, izvan reda %lu\n",
+        pollers, (unsigned long)(ring_push_sum_us / BENCHMARK_RING_EVENTS), (unsigned long)ring_push_max_us,
+        (unsigned long)popped, (unsigned long)overwritten, BENCHMARK_RING_EVENTS, (unsigned long)out_of_order);
+    app_event_ring_deinit(&bench_ring);
+}
+
+void benchmark_event_ring_contention(void)
+{
+    ring_signal = platform_signal_create();
+    if(ring_signal == NULL) {
+        printf("[BENCH RING] ERROR: signal nije stvoren\n");
+        return;
+    }
+
+    run_ring_case(1);
+    run_ring_case(BENCHMARK_RING_POLLERS);
+
+    platform_signal_delete(ring_signal);
+    ring_signal = NULL;
+}
+
+static volatile uint32_t decode_sink; //sprječava da prevoditelj ukloni callbackove
+
+/**
+ * @brief Prazan callback za reporte u benchmarku dekodera.
+ * 
+ * @param report Kompaktni report
+ */
+static void bench_on_report(const CompactReport* report)
+{
+    decode_sink += report->kind;
+}
+
+/**
+ * @brief Prazan callback za response-ove u benchmarku dekodera.
+ * 
+ * @param response Dekodirani response
+ */
+static void bench_on_response(const DecodedResponse* response)
+{
+    decode_sink += response->type;
+}
+
+/**
+ * @struct BenchFrame
+ * @brief Frame (ctrl, cmd, payload) za benchmark dekodera.
+ * 
+ */
+typedef struct {
+    const char* name; /**< Naziv vrste poruke za ispis */
+    uint8_t data[7]; /**< Semantički korisni podatci frame-a */
+    size_t len; /**< Duljina podataka */
+} BenchFrame;
+
+/**
+ * @struct BenchResponseType
+ * @brief Vrsta response-a iz tablice odgovora za benchmark dekodera.
+ * 
+ */
+typedef struct {
+    const char* name; /**< Naziv vrste response-a za ispis */
+    uint8_t ctrl_w; /**< Control word */
+    uint8_t cmd_w; /**< Command word */
+    uint8_t len; /**< Duljina payloada (RESPONSE_LEN_VARIABLE za tekstualne podatke) */
+} BenchResponseType;
+
+#define BENCH_VARIABLE_PAYLOAD_LEN 16 //duljina payloada kojom se mjere response-ovi promjenjive duljine
+#define BENCH_RESPONSE_TYPE(ctrl, cmd, len, type) {#type, ctrl, cmd, len},
+
+/**
+ * @brief Mjeri prosječno trajanje dekodiranja jednog frame-a.
+ * 
+ * @param data Semantički korisni podatci frame-a
+ * @param len Duljina podataka
+ * @return Trajanje dekodiranja jednog frame-a u ns
+ */
+static uint32_t measure_decode_ns(const uint8_t* data, size_t len)
+{
+    uint32_t start = platform_get_cycle_count();
+    for(int i = 0; i < BENCHMARK_DECODE_ITERATIONS; i++) {
+        app_mmwave_decoder_process_frame(data, len);
+    }
+    uint32_t cycles = platform_get_cycle_count() - start;
+    return platform_cycles_to_ns(cycles / BENCHMARK_DECODE_ITERATIONS);
+}
+
+/**
+ * @note Benchmark ne smije raditi dok je pokrenut mmWave manager - koristi vlastiti kontekst dekodera.
+ * Mjeri se svaki red APP_MMWAVE_RESPONSE_TABLE (redom tablice), pa se vidi da trajanje ne raste s položajem u tablici.
+ * 
+ */
+void benchmark_decoder_dispatch(void)
+{
+    static const BenchResponseType responses[] = {
+        APP_MMWAVE_RESPONSE_TABLE(BENCH_RESPONSE_TYPE)
+    };
+    static const BenchFrame frames[] = {
+        {"presence report", {0x80, 0x01, 0x01}, 3},
+        {"UOF report", {0x08, 0x01, 0x10, 0x03, 0x20, 0x04, 0x0C}, 7},
+        {"nepoznat frame", {0x33, 0x44, 0x00}, 3}
+    };
+    AppDecoderContext ctx = {
+        .sendReportCallback = bench_on_report,
+        .sendResponseCallback = bench_on_response
+    };
+    app_mmwave_decoder_init(&ctx);
+
+    uint8_t data[2 + MAX_RESPONSE_DATA_LEN] = {0};
+    uint32_t min_ns = UINT32_MAX;
+    uint32_t max_ns = 0;
+    uint64_t sum_ns = 0;
+    size_t count = sizeof(responses) / sizeof(responses[0]);
+    for(size_t r = 0; r < count; r++) {
+        size_t payload_len = (responses[r].len == RESPONSE_LEN_VARIABLE) ? BENCH_VARIABLE_PAYLOAD_LEN : responses[r].len;
+        data[0] = responses[r].ctrl_w;
+        data[1] = responses[r].cmd_w;
+        uint32_t ns = measure_decode_ns(data, 2 + payload_len);
+        printf("[BENCH DECODE] response %u/%u %s: %lu ns/frame\n", (unsigned)(r + 1), (unsigned)count, responses[r].name,
+            (unsigned long)ns);
+        min_ns = (ns < min_ns) ? ns : min_ns;
+        max_ns = (ns > max_ns) ? ns : max_ns;
+        sum_ns += ns;
+    }
+    printf("[BENCH DECODE] response-ovi (%u vrsta): min %lu, prosjek %lu, max %lu ns/frame (%d frame-ova po vrsti)\n",
+        (unsigned)count, (unsigned long)min_ns, (unsigned long)(sum_ns / count), (unsigned long)max_ns,
+        BENCHMARK_DECODE_ITERATIONS);
+
+    for(size_t f = 0; f < sizeof(frames) / sizeof(frames[0]); f++) {
+        printf("[BENCH DECODE] %s: %lu ns/frame (%d frame-ova)\n", frames[f].name,
+            (unsigned long)measure_decode_ns(frames[f].data, frames[f].len), BENCHMARK_DECODE_ITERATIONS);
+    }
+
+    app_mmwave_decoder_deinit();
+}
+
+void benchmark_startup_config(void)
+{
+    MmwaveConfigProfile profile = {
+        .fields = MMWAVE_CONFIG_BASIC,
+        .scene = LIVING_ROOM,
+        .sensitivity = SENSITIVITY_3,
+        .time_for_no_person = TEN_SEC,
+        .uof_output_switch = TURN_ON
+    };
+
+    //prvo pokretanje puni cache (i po potrebi postavlja senzor), a sljedeća bi trebala sve preskočiti
+    for(int run = 0; run < BENCHMARK_STARTUP_RUNS; run++) {
+        uint32_t start = platform_getNumOfMs();
+        if(mmwave_init() != APP_SENSOR_OK || mmwave_start() != APP_SENSOR_OK) {
+            printf("[BENCH STARTUP] ERROR kod pokretanja mmWave managera\n");
+            mmwave_deinit();
+            return;
+        }
+
+        //postavke se šalju čim senzor javi završenu inicijalizaciju
+        MmwaveConfigResult result = {0};
+        AppSensorStatus status = mmwave_wait_ready(BENCHMARK_STARTUP_TIMEOUT_MS);
+        uint32_t ready_ms = platform_getNumOfMs() - start;
+        if(status == APP_SENSOR_OK) {
+            status = mmwave_sync_config(&profile, &result, BENCHMARK_STARTUP_CONFIG_TIMEOUT_MS);
+        }
+        uint32_t configured_ms = platform_getNumOfMs() - start;
+
+        //prvi report nakon usklađivanja je izmjeren s traženim postavkama
+        DecodedReport report;
+        while(mmwave_poll_report(&report, 0)) {}
+        bool got_report = false;
+        while(!got_report && platform_getNumOfMs() - start < BENCHMARK_STARTUP_TIMEOUT_MS) {
+            got_report = mmwave_poll_report(&report, BENCHMARK_STARTUP_TIMEOUT_MS - (platform_getNumOfMs() - start));
+        }
+        uint32_t report_ms = platform_getNumOfMs() - start;
+
+        mmwave_stop();
+        mmwave_deinit();
+
+        printf("[BENCH STARTUP] run %d: status=%d, spreman za %lu ms, konfiguriran za %lu ms (poslano 0x%lx, "
+            "preskoceno 0x%lx, neuspjelo 0x%lx), ", run, status, (unsigned long)ready_ms,
+            (unsigned long)configured_ms, (unsigned long)result.confirmed,
+            (unsigned long)result.skipped, (unsigned long)result.failed);
+        if(got_report) {
+            printf("prvi report za %lu ms\n", (unsigned long)report_ms);
+        } else {
+            printf("nema reporta unutar %d ms\n", BENCHMARK_STARTUP_TIMEOUT_MS);
+        }
+    }
+}
+
+void benchmark_run_all(void)
+{
+    benchmark_task_jitter();
+    benchmark_uart_event_path();
+    benchmark_allocs_per_frame();
+    benchmark_event_ring_contention();
+    benchmark_decoder_dispatch();
+    benchmark_startup_config();
+}
\ No newline at end of file
@@ -38,7 +38,8 @@ static mmWave_core_interface mmwave_int = {
     .mmwave_parse_data = mmwave_parse_data,
     .mmwave_core_init = mmwave_core_init,
     .mmwave_core_stop = mmwave_core_stop,
-    .mmwave_build_frame = mmwave_build_frame
+    .mmwave_build_frame = mmwave_build_frame,
+    .mmwave_core_reset = mmwave_core_reset
 }; 
 
 static hal_mmwave_config hal_cfg = {
@@ -50,7 +51,12 @@ static hal_mmwave_config hal_cfg = {
     .rx_buff_size = RX_BUFF_SIZE,
     .tx_buff_size = TX_BUFF_SIZE,
     .rx_thresh = RX_THRESH,
-    .event_queue_len = EVENT_QUEUE_LEN
+    .rx_timeout = RX_TIMEOUT,
+    .rx_adaptive = RX_ADAPTIVE,
+    .frame_end_detection = FRAME_END_DETECTION,
+    .frame_tail_byte = FOOTER2,
+    .event_queue_len = EVENT_QUEUE_LEN,
+    .direct_events = DIRECT_UART_EVENTS
 };
 
 void hal_mmwave_run_test(void)
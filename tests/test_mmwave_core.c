@@ -14,6 +14,7 @@
  * - Pokušaja parsiranja frame-a s neispravnim checksumom
  * - Slanja i parsiranja više frame-ova u istom skupu ulaznih podataka
  * - Pokušaja parsiranja neispravnog frame-a
+ * - Odbacivanja djelomično primljenog frame-a (oporavak nakon gubitka podataka)
  * - Izgradnje frame-a
  * - Zaustavljanja rada mmWave core sloja
  * 
@@ -192,7 +193,24 @@ void mmwave_core_run_test(void) {
         printf("[CORE test] ERROR Smece frame uspjesno prihvacen i parsiran - frames_saved=%d\n", frames_saved);
     }
 
-    //[5]. Sada nam još preostaje ispitati izgradnju frame-a:
+    //[5]. Ispitujemo odbacivanje djelomičnog frame-a (npr. nakon preljeva UART buffera):
+    reset_test_state();
+
+    //Prva polovica frame-a stigne, ostatak se izgubi - nakon reseta stiže novi cijeli frame
+    uint8_t partial_frame[] = {0x53, 0x59, 0x01, 0x02, 0x00, 0x01};
+    mmwave_parse_data(partial_frame, sizeof(partial_frame));
+    if(mmwave_core_reset() != S_MMWAVE_OK) {
+        printf("[CORE test] ERROR reset parsera neuspjesan\n");
+    }
+    mmwave_parse_data(valid_frame, sizeof(valid_frame));
+
+    if(frames_saved == 1 && last_cmd_w == 0x01 && last_payload_len == 1 && last_payload[0] == 0x0F) {
+        printf("[CORE test] Djelomican frame odbacen, sljedeci frame ispravno parsiran\n");
+    } else {
+        printf("[CORE test] ERROR Nakon reseta ocekivan 1 ispravan frame, a imamo: %d\n", frames_saved);
+    }
+
+    //[6]. Sada nam još preostaje ispitati izgradnju frame-a:
     uint8_t payload[] = {0x0F};
     mmWaveFrameForTX tx_frame;
     
@@ -28,6 +28,13 @@ static void stress_task(void* arg)
         app_log_system_snapshot();
         sent_via_network_statistics(&report_c, &response_c);
         printf("Reports: %ld; Responses: %ld;\n", report_c, response_c);
+        MmwaveState state;
+        mmwave_get_state(&state);
+        uint32_t now = platform_getNumOfMs();
+        printf("State: presence=%d (%lu ms), motion=%d (%lu ms), bmp=%d (%lu ms), updates=%lu\n",
+            state.presence, (unsigned long)(state.presence_ms ? now - state.presence_ms : 0),
+            state.motion, (unsigned long)(state.motion_ms ? now - state.motion_ms : 0),
+            state.bmp, (unsigned long)(state.bmp_ms ? now - state.bmp_ms : 0), (unsigned long)state.updates);
         printf("\n");
         platform_delay_task(SYSTEM_STATISTICS_LOG_INTERVAL);
     }
@@ -53,24 +60,55 @@ void stress_run_test(void)
 
     uint32_t start = platform_getNumOfMs();
 
-    TaskConfig_t st = {stress_task, "stress_task", 12000, NULL, 8};
+    TaskConfig_t st = {
+        .task_function = stress_task,
+        .task_name = "stress_task",
+        .task_stack = 12000,
+        .task_parameters = NULL,
+        .task_priority = 8,
+        .task_core = PLATFORM_TASK_CORE_ANY
+    };
     st_task = platform_create_task(&st);
 
-    platform_delay_task(5000);
+    uint32_t ready_start = platform_getNumOfMs();
+    AppSensorStatus ready_status = mmwave_wait_ready(STRESS_READY_TIMEOUT_MS);
+    printf("Ready: status=%d, %lu ms\n", ready_status, (unsigned long)(platform_getNumOfMs() - ready_start));
 
-    app_inquiry_scene_settings_set(LIVING_ROOM);
-    app_inquiry_time_for_no_person_set(TEN_SEC);
-    app_inquiry_uof_output_switch_set(TURN_ON);
+    MmwaveConfigProfile profile = {
+        .fields = MMWAVE_CONFIG_SCENE | MMWAVE_CONFIG_TIME_FOR_NO_PERSON | MMWAVE_CONFIG_UOF_OUTPUT_SWITCH,
+        .scene = LIVING_ROOM,
+        .time_for_no_person = TEN_SEC,
+        .uof_output_switch = TURN_ON
+    };
+    MmwaveConfigResult config_result;
+    AppSensorStatus config_status = mmwave_sync_config(&profile, &config_result, STRESS_CONFIG_TIMEOUT_MS);
+    printf("Config: status=%d, confirmed=0x%lx, failed=0x%lx, skipped=0x%lx, %lu ms\n", config_status,
+        (unsigned long)config_result.confirmed, (unsigned long)config_result.failed,
+        (unsigned long)config_result.skipped,
+        (unsigned long)config_result.elapsed_ms);
+
+    //heartbeat i energija se traže periodički kroz raspored upita, a odgovori idu mrežom kao i ostali response-ovi
+    int heartbeat_id = -1;
+    int energy_id = -1;
+    if(mmwave_schedule_inquiry(HEARTBEAT, STRESS_HEARTBEAT_PERIOD_MS, &heartbeat_id) != APP_SENSOR_OK ||
+        mmwave_schedule_inquiry(EXISTENCE_ENERGY, STRESS_ENERGY_PERIOD_MS, &energy_id) != APP_SENSOR_OK) {
+        printf("Raspored upita nije postavljen\n");
+    }
 
     while(platform_getNumOfMs() - start < TEST_DURATION) {
         //wait
         platform_delay_task(50);
     }
+    mmwave_unschedule_inquiry(heartbeat_id);
+    mmwave_unschedule_inquiry(energy_id);
     stop_flag = true;
     while(task_ended != true) {
         platform_delay_task(10);
     }
     
+    //zadnji trace zapisi (tools/trace_to_chrome.py pretvara ispis u Chrome trace) - prazni ako build nije s MMWAVE_TRACE=ON
+    platform_trace_dump_console();
+
     network_stop();
     mmwave_stop();
 
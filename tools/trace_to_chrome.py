@@ -0,0 +1,144 @@
+#!/usr/bin/env python3
+"""
+Pretvara trace zapise mmWave drivera u Chrome trace JSON (chrome://tracing, https://ui.perfetto.dev).
+
+Ulaz može biti:
+  - log s konzole (linije "TRACE,<us>,<core>,<event>,<arg>,<task>" koje ispisuje platform_trace_dump_console()),
+  - binarna datoteka s uzastopno spremljenim PACKET_TRACE paketima primljenim preko websocketa.
+
+Primjer:
+  python3 tools/trace_to_chrome.py monitor.log -o trace.json
+  python3 tools/trace_to_chrome.py --binary trace_packets.bin -o trace.json
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+# Mora odgovarati PlatformTraceEvent u platform_trace.h
+EVENTS = [
+    "TASK_WAKE",
+    "QUEUE_SEND",
+    "QUEUE_RECV",
+    "PARSE_BEGIN",
+    "PARSE_END",
+    "FRAME",
+    "DECODE_BEGIN",
+    "DECODE_END",
+    "NET_SEND",
+    "UART_TX",
+]
+
+# Parovi početak/kraj koji se prikazuju kao trajanje (slice)
+BEGIN_END = {
+    "PARSE_BEGIN": ("parse", "B"),
+    "PARSE_END": ("parse", "E"),
+    "DECODE_BEGIN": ("decode", "B"),
+    "DECODE_END": ("decode", "E"),
+}
+
+PACKET_TRACE = 2
+HEADER_FMT = "<BBIB"  # PacketHeader_t: version, type, timestamp, payload_len
+RECORD_FMT = "<IBBH4s"  # PlatformTraceRecord_t
+HEADER_SIZE = struct.calcsize(HEADER_FMT)
+RECORD_SIZE = struct.calcsize(RECORD_FMT)
+
+
+def parse_console(lines):
+    records = []
+    for line in lines:
+        idx = line.find("TRACE,")
+        if idx < 0:
+            continue
+        parts = line[idx:].strip().split(",", 5)
+        if len(parts) != 6:
+            continue
+        try:
+            ts, core, event, arg = (int(p) for p in parts[1:5])
+        except ValueError:
+            continue
+        records.append((ts, core, event, arg, parts[5]))
+    return records
+
+
+def parse_binary(data):
+    records = []
+    pos = 0
+    while pos + HEADER_SIZE <= len(data):
+        _, ptype, _, payload_len = struct.unpack_from(HEADER_FMT, data, pos)
+        pos += HEADER_SIZE
+        payload = data[pos:pos + payload_len]
+        pos += payload_len
+        if ptype != PACKET_TRACE or not payload:
+            continue
+        count = payload[0]
+        for i in range(count):
+            off = 1 + i * RECORD_SIZE
+            if off + RECORD_SIZE > len(payload):
+                break
+            ts, core, event, arg, task = struct.unpack_from(RECORD_FMT, payload, off)
+            records.append((ts, core, event, arg, task.split(b"\0")[0].decode("ascii", "replace")))
+    return records
+
+
+def unwrap_timestamps(records):
+    """Zapisi su 32-bitni us brojač - sortira po vremenu i ispravlja preljev (~71 min)."""
+    records.sort(key=lambda r: r[0])
+    if not records:
+        return records
+    # ako je razmak između susjednih zapisa veći od pola raspona, brojač se prelio
+    span = 1 << 32
+    gaps = [(records[i + 1][0] - records[i][0], i) for i in range(len(records) - 1)]
+    big = [i for gap, i in gaps if gap > span // 2]
+    if big:
+        # zapisi iza najvećeg razmaka su stariji (prije preljeva), a oni ispred su nakon preljeva
+        cut = big[-1] + 1
+        records = records[cut:] + [(ts + span, *rest) for ts, *rest in records[:cut]]
+    return records
+
+
+def to_chrome(records):
+    events = []
+    tids = {}
+    for ts, core, event, arg, task in records:
+        name = EVENTS[event] if event < len(EVENTS) else "EVENT_%d" % event
+        tid = tids.setdefault((core, task), len(tids) + 1)
+        ev = {"ts": ts, "pid": core, "tid": tid, "args": {"arg": arg}}
+        if name in BEGIN_END:
+            ev["name"], ev["ph"] = BEGIN_END[name]
+        else:
+            ev["name"], ev["ph"], ev["s"] = name, "i", "t"
+        events.append(ev)
+    for (core, task), tid in tids.items():
+        events.append({"name": "thread_name", "ph": "M", "pid": core, "tid": tid, "args": {"name": task}})
+    for core in sorted({core for core, _ in tids}):
+        events.append({"name": "process_name", "ph": "M", "pid": core, "args": {"name": "core %d" % core}})
+    return {"traceEvents": events, "displayTimeUnit": "ms"}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("input", help="log s konzole ili binarna datoteka s PACKET_TRACE paketima")
+    parser.add_argument("--binary", action="store_true", help="ulaz je binarna datoteka s paketima")
+    parser.add_argument("-o", "--output", default="-", help="izlazna JSON datoteka (zadano: stdout)")
+    args = parser.parse_args()
+
+    if args.binary:
+        with open(args.input, "rb") as f:
+            records = parse_binary(f.read())
+    else:
+        with open(args.input, "r", errors="replace") as f:
+            records = parse_console(f)
+
+    trace = to_chrome(unwrap_timestamps(records))
+    if args.output == "-":
+        json.dump(trace, sys.stdout)
+    else:
+        with open(args.output, "w") as f:
+            json.dump(trace, f)
+    print("%d zapisa" % len(records), file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()